@@ -12,6 +12,12 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <climits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "SortCore.h"
+#include "ParallelSort.h"
 
 // ---------------------------------------------------------
 // Utility Easing + Helpers
@@ -37,13 +43,13 @@ Color ColorWithAlpha(Color c, float alpha)
 // ---------------------------------------------------------
 // Cell Visual Data
 // ---------------------------------------------------------
-// logicalValue:   used by algorithms (bubble sort, shifts, delete)
+// logicalValue:   used by algorithms (sorts, shifts, delete)
 // displayValue:   what the player currently sees inside the slot
 // offsetX/Y:      animation offset (hover, swaps, etc.)
 // overlayColor:   temporary highlight color (RED/GREEN/BLUE/ORANGE…)
 // overlayAlpha:   visibility of overlay (0=transparent,1=solid)
 // overlayTimer:   >=0 → countdown then fade, <0 → stays on (no fade)
-// sortedLocked:   once bubble-sort knows this index is final
+// sortedLocked:   once the sort knows this index is final
 // ---------------------------------------------------------
 struct Cell
 {
@@ -63,6 +69,159 @@ struct Cell
     bool  sortedLocked   = false;
 };
 
+// ---------------------------------------------------------
+// Array Size + Render Modes
+// ---------------------------------------------------------
+// The array size is picked at runtime (SIZE - / SIZE +) from
+// SIZE_PRESETS. How the array is drawn follows from how many
+// pixels each element gets:
+//   Boxes   → labelled boxes, while a slot is >= MIN_BOX_PITCH
+//   Bars    → one bar per element, height ∝ value
+//   Columns → more elements than pixels: every pixel column
+//             draws the min..max of the values that fall in it
+// Outside Boxes, sort and shift skip the per-step animation and
+// apply a batch of steps every frame instead.
+// ---------------------------------------------------------
+const int SIZE_PRESETS[] = { 8, 16, 32, 64, 128, 256, 512, 1024,
+                             4096, 16384, 65536, 262144, 1048576, 4194304 };
+const int SIZE_PRESET_COUNT = sizeof(SIZE_PRESETS) / sizeof(SIZE_PRESETS[0]);
+
+const float MAX_BOX_SIZE  = 95.0f;   // box size / gap of the 8-cell layout
+const float MAX_PADDING   = 28.0f;
+const float MIN_BOX_PITCH = 40.0f;   // narrower than this → bars
+const float ARRAY_MARGIN  = 60.0f;   // left/right margin around the array
+const float BARS_TOP      = 150.0f;  // tallest bar reaches up to here
+
+const int FAST_SHIFT_FRAMES = 60;    // fast shift: done in about a second
+
+const Color LOCKED_GREEN = { 144, 238, 144, 255 };
+
+// One colour per thread of a parallel sort (wraps past 8 threads)
+const Color PARTITION_COLORS[] = { SKYBLUE, ORANGE, LIME, VIOLET, GOLD, PINK, BEIGE, DARKGREEN };
+const int   PARTITION_COLOR_COUNT = sizeof(PARTITION_COLORS) / sizeof(PARTITION_COLORS[0]);
+
+enum class RenderMode
+{
+    Boxes,
+    Bars,
+    Columns
+};
+
+struct ArrayLayout
+{
+    RenderMode mode    = RenderMode::Boxes;
+    float      pitch   = 0.0f;   // distance between neighbouring slots
+    float      boxW    = 0.0f;   // box / bar width
+    float      boxH    = 0.0f;   // box height, or full bar height
+    float      padding = 0.0f;
+    float      startX  = 0.0f;
+    float      width   = 0.0f;   // whole array on screen
+    float      base    = 0.0f;   // boxes sit and bars stand on this line
+    float      top     = 0.0f;   // bars: value range maps to [base, top]
+};
+
+ArrayLayout ComputeLayout(int n, float screenW, float screenH)
+{
+    ArrayLayout L;
+    float fullPitch = MAX_BOX_SIZE + MAX_PADDING;
+    float room      = screenW - 2.0f * ARRAY_MARGIN;
+
+    L.base = screenH * 0.40f + MAX_BOX_SIZE;
+    L.top  = BARS_TOP;
+
+    // The last box has no padding after it, hence room + MAX_PADDING
+    L.pitch = std::min(fullPitch, (room + MAX_PADDING) / n);
+
+    if (L.pitch >= MIN_BOX_PITCH)
+    {
+        L.mode    = RenderMode::Boxes;
+        L.boxW    = L.pitch * (MAX_BOX_SIZE / fullPitch);
+        L.boxH    = L.boxW;
+        L.padding = L.pitch - L.boxW;
+        L.width   = n * L.pitch - L.padding;
+    }
+    else
+    {
+        L.pitch = room / n;
+        L.mode  = (L.pitch >= 1.0f) ? RenderMode::Bars : RenderMode::Columns;
+        L.boxW  = std::max(1.0f, L.pitch >= 4.0f ? L.pitch - 1.0f : L.pitch);
+        L.boxH  = L.base - L.top;
+        L.width = room;
+    }
+
+    L.startX = screenW / 2.0f - L.width / 2.0f;
+    return L;
+}
+
+// ---------------------------------------------------------
+// Column Aggregates (Columns render mode)
+// ---------------------------------------------------------
+// lo[c] / hi[c] = min / max displayValue of the elements that
+// land in pixel column c, i.e. [c*n/columns, (c+1)*n/columns).
+// Rescanning millions of cells every frame would stall the
+// window, so writes mark the index range they touched and only
+// the columns overlapping that range are recomputed.
+// ---------------------------------------------------------
+struct ColumnCache
+{
+    std::vector<int> lo;
+    std::vector<int> hi;
+    int n         = -1;        // array size the columns were built for (-1 = stale)
+    int dirtyFrom = INT_MAX;   // index range written since the last refresh
+    int dirtyTo   = -1;
+};
+
+void MarkDirty(ColumnCache& cc, int from, int to)
+{
+    if (from < cc.dirtyFrom) cc.dirtyFrom = from;
+    if (to   > cc.dirtyTo)   cc.dirtyTo   = to;
+}
+
+void RefreshColumns(ColumnCache& cc, const std::vector<Cell>& cells, int columns)
+{
+    int n     = (int)cells.size();
+    int first = 0;
+    int last  = columns - 1;
+
+    if (cc.n != n || (int)cc.lo.size() != columns)
+    {
+        cc.lo.assign(columns, 0);
+        cc.hi.assign(columns, 0);
+        cc.n = n;
+    }
+    else if (cc.dirtyFrom > cc.dirtyTo)
+    {
+        return;
+    }
+    else
+    {
+        // ±1 column: the floor in the range bounds can put an index
+        // one column over from i * columns / n
+        first = std::max(0,           (int)((long long)cc.dirtyFrom * columns / n) - 1);
+        last  = std::min(columns - 1, (int)((long long)cc.dirtyTo   * columns / n) + 1);
+    }
+
+    for (int c = first; c <= last; ++c)
+    {
+        int a = (int)((long long)c       * n / columns);
+        int b = (int)((long long)(c + 1) * n / columns);
+
+        int mn = cells[a].displayValue;
+        int mx = mn;
+        for (int i = a + 1; i < b; ++i)
+        {
+            int v = cells[i].displayValue;
+            if (v < mn) mn = v;
+            if (v > mx) mx = v;
+        }
+        cc.lo[c] = mn;
+        cc.hi[c] = mx;
+    }
+
+    cc.dirtyFrom = INT_MAX;
+    cc.dirtyTo   = -1;
+}
+
 // ---------------------------------------------------------
 // Global Animation Modes
 // ---------------------------------------------------------
@@ -72,38 +231,177 @@ enum class GlobalAnimType
     Sort,
     ShiftLeft,
     ShiftRight,
-    Delete
+    Delete,
+    Parallel
 };
 
 // ---------------------------------------------------------
-// Bubble Sort Animation State
+// Sort Playback State
 // ---------------------------------------------------------
-// We visualise Bubble Sort step-by-step.
-// For each pair (j, j+1):
-//   CompareLift     → both ORANGE, hover up
-//   CompareDecision → RED/GREEN (swap) or BLUE (stable)
-//   SwapMove        → animated swap (if needed)
-//   PostStep        → move to next pair / pass
-// After each pass i, index (n-1-i) is locked (LIGHTGREEN).
+// SORT first records the whole run (SortRecorder → SortLog, see
+// SortCore.h), then plays the log back onto the cells. Playback
+// can pause, run in reverse, change speed and seek to any step;
+// the algorithm itself never waits on the animation.
+//
+// In Boxes mode each event is animated:
+//   Compare → CompareLift     → both ORANGE, hover up
+//             CompareDecision → RED/GREEN (out of order) or BLUE
+//   Swap    → SwapMove        → the two cells cross over
+//   Write   → WriteValue      → new value drops into the slot
+//   Lock    → index is final (LIGHTGREEN), no pause
+// with a PostStep pause after compares and swaps; the speed
+// multiplier shortens all of them. Bars/Columns apply
+// 60 × speed events per second without animation.
 // ---------------------------------------------------------
+const int PLAYBACK_SPEEDS[] = { 1, 2, 5, 10, 20, 50, 100, 200, 500,
+                                1000, 2000, 5000, 10000 };
+const int PLAYBACK_SPEED_COUNT = sizeof(PLAYBACK_SPEEDS) / sizeof(PLAYBACK_SPEEDS[0]);
+
+// 8 bytes each (plus about a quarter of that again in snapshots)
+const size_t LOG_EVENT_LIMIT = 64u << 20;
+
 struct SortState
 {
-    bool active = false;
+    bool active    = false;      // a run is loaded (recording, playing or paused)
+    bool recording = false;      // still waiting for SortRecorder
 
-    int  i = 0;          // outer loop index
-    int  j = 0;          // inner loop index
-    int  n = 0;          // array size
+    SortAlgorithm algorithm = SortAlgorithm::Bubble;
+
+    // Playback
+    size_t position   = 0;       // events applied to the cells so far
+    bool   playing    = false;
+    bool   reverse    = false;
+    int    speedIndex = 0;       // into PLAYBACK_SPEEDS
+    float  owed       = 0.0f;    // Bars/Columns: fraction of an event carried over
+
+    // Boxes: event being animated
+    SortEvent event    = {};     // for Write, b = old ^ new (as logged)
+    bool      undo     = false;  // event is being played backwards
+    bool      hasEvent = false;
+    bool      lifted   = false;  // event's pair still hovering from its compare
 
     enum Phase
     {
         CompareLift,
         CompareDecision,
         SwapMove,
+        WriteValue,
         PostStep
     } phase = CompareLift;
 
     float t = 0.0f;      // 0..1 time inside current phase
     bool  swapNeeded = false;
+    bool  fast       = false;   // Bars/Columns: batch of events per frame
+
+    // Totals for the run, to compare algorithms by
+    long long compares = 0;
+    long long swaps    = 0;
+    long long writes   = 0;
+};
+
+// ---------------------------------------------------------
+// Sort Recorder
+// ---------------------------------------------------------
+// Records a run on a worker thread so the window keeps drawing
+// while a large sort is logged.
+//
+// Start → copy of the values, RecordSort begins
+// Ready → recording finished; `log` belongs to the caller now
+// Stop  → cancel and join (RecordSort gives up at its next chunk
+//         of events, even mid-way through an O(n²) sort)
+// ---------------------------------------------------------
+class SortRecorder
+{
+public:
+    SortLog log;
+
+    ~SortRecorder() { Stop(); }
+
+    void Start(SortAlgorithm algorithm, std::vector<int> values)
+    {
+        Stop();
+        cancel = false;
+        done   = false;
+
+        worker = std::thread([this, algorithm, data = std::move(values)]() mutable
+        {
+            RecordSort(algorithm, std::move(data), log, LOG_EVENT_LIMIT, &cancel);
+            done = true;
+        });
+    }
+
+    void Stop()
+    {
+        cancel = true;
+        if (worker.joinable())
+            worker.join();
+    }
+
+    bool Ready()
+    {
+        if (!done)
+            return false;
+        if (worker.joinable())
+            worker.join();
+        return true;
+    }
+
+private:
+    std::thread       worker;
+    std::atomic<bool> cancel { false };
+    std::atomic<bool> done   { false };
+};
+
+// ---------------------------------------------------------
+// Parallel Runner
+// ---------------------------------------------------------
+// Runs CompareParallel (ParallelSort.h) off the render thread:
+// this thread only drives the comparison, the pool's threads do
+// the sorting. Same Start / Ready / Stop shape as SortRecorder,
+// except a running sort can't be cancelled, so Stop waits for it
+// (well under a second at 4M elements).
+// ---------------------------------------------------------
+class ParallelRunner
+{
+public:
+    ParallelResult result;
+
+    ~ParallelRunner() { Stop(); }
+
+    void Start(ParallelAlgorithm algorithm, std::vector<int> values)
+    {
+        Stop();
+        done = false;
+
+        worker = std::thread([this, algorithm, data = std::move(values)]()
+        {
+            result = CompareParallel(algorithm, data, pool);
+            done   = true;
+        });
+    }
+
+    void Stop()
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+
+    bool Ready()
+    {
+        if (!done)
+            return false;
+        if (worker.joinable())
+            worker.join();
+        return true;
+    }
+
+    int Threads() const { return pool.Threads(); }
+
+private:
+    // Every core: the pool's own threads plus the one running Start
+    WorkStealingPool  pool { (int)std::max(1u, std::thread::hardware_concurrency()) - 1 };
+    std::thread       worker;
+    std::atomic<bool> done { false };
 };
 
 // ---------------------------------------------------------
@@ -130,6 +428,7 @@ struct ShiftSwapState
     bool active      = false;
     bool isDelete    = false;
     bool left        = true;     // logical direction (for info only)
+    bool fast        = false;    // Bars/Columns: batch of swaps per frame
 
     int  startIndex  = 0;        // used by delete
 
@@ -192,8 +491,9 @@ int main()
     // -------------------------------------------------------------
     // Array / cell setup
     // -------------------------------------------------------------
-    const int ARRAY_SIZE = 8;
-    std::vector<Cell> cells(ARRAY_SIZE);
+    int sizePreset = 0;
+    int arraySize  = SIZE_PRESETS[sizePreset];
+    std::vector<Cell> cells(arraySize);
 
     // Text input and selection state
     int         selectedIndex = -1;
@@ -202,29 +502,63 @@ int main()
 
     // Button animation (squish on press)
     float squishT           = 0.0f;
-    int   lastPressedButton = -1; // -1 none, 0 sort,1 delete,2 shiftL,3 shiftR,4 reset,-2 enter
+    int   lastPressedButton = -1; // -1 none, 0 sort,1 delete,2 shiftL,3 shiftR,4 reset,
+                                  // 5 size-,6 size+,7 random,8 algorithm,
+                                  // 9 parallel,-2 enter
 
-    // Layout constants
-    const float boxW    = 95.0f;
-    const float boxH    = 95.0f;
-    const float padding = 28.0f;
+    // Layout (recomputed every frame from arraySize and the window)
+    ArrayLayout layout = ComputeLayout(arraySize, GetScreenWidth(), GetScreenHeight());
+    ColumnCache columnCache;
+    int         valueMax = 1;     // bar height scale
 
     // Animation / algorithm state
     GlobalAnimType currentAnim   = GlobalAnimType::None;
     SortState      sortState;
     ShiftSwapState shiftState;
+    SortRecorder   sortRecorder;
+    ParallelRunner parallelRunner;
+
+    // Thread that sorted each index in the last parallel sort
+    // (empty → normal colours)
+    std::vector<uint8_t> partitionOwner;
+
+    // Cells with an overlay running, so fading them doesn't mean
+    // walking millions of idle cells every frame
+    std::vector<int> overlayCells;
 
-    // Compute a slot's base position (index → screen)
+    // Pair touched last by a fast (batched) sort / shift step
+    int hotA = -1;
+    int hotB = -1;
+
+    // Compute a slot's base position (index → screen).
+    // Boxes: top-left of the box. Bars/Columns: top of the bar area.
     auto GetSlotBasePos = [&](int index) -> Vector2
     {
-        float totalW = ARRAY_SIZE * (boxW + padding) - padding;
-        float startX = GetScreenWidth() / 2.0f - totalW / 2.0f;
-        float y      = GetScreenHeight() * 0.40f;
-        return { startX + index * (boxW + padding), y };
+        float x = layout.startX + index * layout.pitch;
+        if (layout.mode == RenderMode::Boxes)
+            return { x, layout.base - layout.boxH };
+        return { x, layout.top };
+    };
+
+    // Index under the mouse, or -1
+    auto HitTest = [&](Vector2 p) -> int
+    {
+        int i = (int)floorf((p.x - layout.startX) / layout.pitch);
+        if (i < 0 || i >= arraySize)
+            return -1;
+
+        Vector2   basePos = GetSlotBasePos(i);
+        Rectangle r       = { basePos.x, basePos.y, layout.boxW, layout.boxH };
+
+        // Bars/Columns: anywhere in the element's strip counts
+        if (layout.mode != RenderMode::Boxes)
+            r.width = std::max(layout.pitch, 1.0f);
+
+        return CheckCollisionPointRec(p, r) ? i : -1;
     };
 
     // Initialise all cells to zero values and default visuals
-    for (int i = 0; i < ARRAY_SIZE; ++i)
+    for (int i = 0; i < arraySize; ++i)
     {
         cells[i].logicalValue  = 0;
         cells[i].displayValue  = 0;
@@ -240,10 +574,33 @@ int main()
     // Helper lambdas for controlling algorithm animations
     // -------------------------------------------------------------
 
+    // TriggerOverlay + remember the cell for the per-frame fade
+    auto Flash = [&](int i, Color color, float duration)
+    {
+        if (!cells[i].overlayActive)
+            overlayCells.push_back(i);
+        TriggerOverlay(cells[i], color, duration);
+    };
+
+    // Swap two values (logical and displayed) and mark them for the column view
+    auto SwapValues = [&](int a, int b)
+    {
+        std::swap(cells[a].logicalValue, cells[b].logicalValue);
+        std::swap(cells[a].displayValue, cells[b].displayValue);
+        MarkDirty(columnCache, std::min(a, b), std::max(a, b));
+    };
+
+    auto RecomputeValueMax = [&]()
+    {
+        valueMax = 1;
+        for (int i = 0; i < arraySize; ++i)
+            valueMax = std::max(valueMax, cells[i].logicalValue);
+    };
+
     // Reset all animation-related visuals (keeps actual values)
     auto ClearAlgorithmVisuals = [&]()
     {
-        for (int i = 0; i < ARRAY_SIZE; ++i)
+        for (int i = 0; i < arraySize; ++i)
         {
             cells[i].offsetX       = 0.0f;
             cells[i].offsetY       = 0.0f;
@@ -252,24 +609,191 @@ int main()
             cells[i].overlayTimer  = 0.0f;
             cells[i].sortedLocked  = false;
         }
+        overlayCells.clear();
+        partitionOwner.clear();
+        hotA = -1;
+        hotB = -1;
     };
 
-    // Start bubble sort animation
+    // Apply one logged event to the cells, or undo it
+    auto ApplyLogged = [&](SortEventType type, int a, int b, bool undo)
+    {
+        switch (type)
+        {
+            case SortEventType::Compare:
+                hotA = a;
+                hotB = b;
+                break;
+
+            case SortEventType::Swap:
+                SwapValues(a, b);
+                hotA = a;
+                hotB = b;
+                break;
+
+            case SortEventType::Write:
+            {
+                // b = old ^ new, the same flip both ways
+                int v = cells[a].logicalValue ^ b;
+                cells[a].logicalValue = v;
+                cells[a].displayValue = v;
+                MarkDirty(columnCache, a, a);
+                hotA = a;
+                hotB = -1;
+                break;
+            }
+
+            case SortEventType::Lock:
+                cells[a].sortedLocked = !undo;
+                break;
+        }
+    };
+
+    auto StepForward = [&]()
+    {
+        const LoggedEvent& e = sortRecorder.log.events[sortState.position++];
+        ApplyLogged(EventType(e), EventIndex(e), e.b, false);
+    };
+
+    auto StepBack = [&]()
+    {
+        const LoggedEvent& e = sortRecorder.log.events[--sortState.position];
+        ApplyLogged(EventType(e), EventIndex(e), e.b, true);
+    };
+
+    // Drop a half-played Boxes event. Swaps and writes only count
+    // (and move `position`) once their animation finishes, so the
+    // cells just go back to rest.
+    auto AbortEventAnimation = [&]()
+    {
+        SortState &S = sortState;
+        if (!S.hasEvent)
+            return;
+
+        int a = S.event.a;
+        cells[a].offsetX      = 0.0f;
+        cells[a].offsetY      = 0.0f;
+        cells[a].displayValue = cells[a].logicalValue;
+        if (S.event.type == SortEventType::Compare || S.event.type == SortEventType::Swap)
+        {
+            cells[S.event.b].offsetX = 0.0f;
+            cells[S.event.b].offsetY = 0.0f;
+        }
+        S.hasEvent = false;
+    };
+
+    // Show the array as it was after `target` events. Far jumps
+    // restore the nearest snapshot at or before target and replay
+    // from there, so no seek replays more than one interval.
+    auto SeekTo = [&](size_t target)
+    {
+        SortLog& log = sortRecorder.log;
+        size_t&  pos = sortState.position;
+
+        AbortEventAnimation();
+        target = std::min(target, log.events.size());
+
+        if ((target + log.interval < pos || target > pos + log.interval) && !log.snapshots.empty())
+        {
+            size_t k = std::min(target / log.interval, log.snapshots.size() - 1);
+            const SortSnapshot& snap = log.snapshots[k];
+            for (int i = 0; i < arraySize; ++i)
+            {
+                cells[i].logicalValue = snap.values[i];
+                cells[i].displayValue = snap.values[i];
+                cells[i].sortedLocked = snap.locked[i];
+            }
+            columnCache.n = -1;
+            pos = k * log.interval;
+        }
+
+        while (pos < target) StepForward();
+        while (pos > target) StepBack();
+    };
+
+    // Close the loaded run; the cells keep the step they show
+    auto EndPlayback = [&]()
+    {
+        AbortEventAnimation();
+        sortRecorder.Stop();
+        sortRecorder.log = SortLog();
+
+        sortState.active    = false;
+        sortState.recording = false;
+        sortState.playing   = false;
+        if (currentAnim == GlobalAnimType::Sort)
+            currentAnim = GlobalAnimType::None;
+        hotA = -1;
+        hotB = -1;
+    };
+
+    // A paused run doesn't block the other buttons; using one
+    // closes it first (the log would no longer match the cells)
+    auto LeavePlayback = [&]()
+    {
+        if (currentAnim == GlobalAnimType::Sort && !sortState.playing && !sortState.recording)
+            EndPlayback();
+    };
+
+    // Start the selected sort: the worker records the whole run
+    // from a copy of the values, playback starts once it's done
     auto StartSortAnimation = [&]()
     {
+        LeavePlayback();
         if (currentAnim != GlobalAnimType::None)
             return;
 
         currentAnim          = GlobalAnimType::Sort;
         sortState.active     = true;
-        sortState.i          = 0;
-        sortState.j          = 0;
-        sortState.n          = ARRAY_SIZE;
+        sortState.recording  = true;
+        sortState.playing    = false;
+        sortState.reverse    = false;
+        sortState.position   = 0;
+        sortState.owed       = 0.0f;
+        sortState.event      = {};
+        sortState.hasEvent   = false;
         sortState.t          = 0.0f;
         sortState.phase      = SortState::CompareLift;
         sortState.swapNeeded = false;
+        sortState.fast       = (layout.mode != RenderMode::Boxes);
+        sortState.compares   = 0;
+        sortState.swaps      = 0;
+        sortState.writes     = 0;
+
+        // Start at a pace that suits the view (1x / 20x / 10000x)
+        sortState.speedIndex = (layout.mode == RenderMode::Boxes) ? 0
+                             : (layout.mode == RenderMode::Bars)  ? 4
+                                                                  : PLAYBACK_SPEED_COUNT - 1;
 
         ClearAlgorithmVisuals();
+
+        std::vector<int> values(arraySize);
+        for (int i = 0; i < arraySize; ++i)
+            values[i] = cells[i].logicalValue;
+        sortRecorder.Start(sortState.algorithm, std::move(values));
+    };
+
+    // Sort a copy sequentially and in parallel on a worker thread;
+    // merge sort unless a quicksort is selected
+    auto StartParallelSort = [&]()
+    {
+        LeavePlayback();
+        if (currentAnim != GlobalAnimType::None)
+            return;
+
+        ParallelAlgorithm algorithm =
+            (sortState.algorithm == SortAlgorithm::QuickLomuto ||
+             sortState.algorithm == SortAlgorithm::QuickHoare) ? ParallelAlgorithm::Quick
+                                                               : ParallelAlgorithm::Merge;
+
+        currentAnim = GlobalAnimType::Parallel;
+        ClearAlgorithmVisuals();
+
+        std::vector<int> values(arraySize);
+        for (int i = 0; i < arraySize; ++i)
+            values[i] = cells[i].logicalValue;
+        parallelRunner.result = ParallelResult();
+        parallelRunner.Start(algorithm, std::move(values));
     };
 
     // Build neighbour swap steps for shift-left / shift-right / delete
@@ -282,13 +806,14 @@ int main()
         shiftState.left        = left;
         shiftState.isDelete    = isDelete;
         shiftState.startIndex  = startIndex;
+        shiftState.fast        = (layout.mode != RenderMode::Boxes);
 
         if (!isDelete)
         {
             if (left)
             {
                 // SHIFT LEFT: swap (0,1), (1,2), ..., (N-2,N-1)
-                for (int i = 0; i < ARRAY_SIZE - 1; ++i)
+                for (int i = 0; i < arraySize - 1; ++i)
                 {
                     shiftState.steps.push_back({ i, i + 1 });
                 }
@@ -296,7 +821,7 @@ int main()
             else
             {
                 // SHIFT RIGHT: swap (N-1,N-2), (N-2,N-3), ..., (1,0)
-                for (int i = ARRAY_SIZE - 1; i > 0; --i)
+                for (int i = arraySize - 1; i > 0; --i)
                 {
                     shiftState.steps.push_back({ i, i - 1 });
                 }
@@ -305,7 +830,7 @@ int main()
         else
         {
             // DELETE: swap (s,s+1), (s+1,s+2), ..., (N-2,N-1), then clear last
-            for (int i = startIndex; i < ARRAY_SIZE - 1; ++i)
+            for (int i = startIndex; i < arraySize - 1; ++i)
             {
                 shiftState.steps.push_back({ i, i + 1 });
             }
@@ -314,6 +839,7 @@ int main()
 
     auto StartShiftLeft = [&]()
     {
+        LeavePlayback();
         if (currentAnim != GlobalAnimType::None)
             return;
 
@@ -322,11 +848,12 @@ int main()
         BuildShiftSteps(true, false, 0);
 
         // Index 0 is the origin of the left shift → stay solid RED
-        TriggerOverlay(cells[0], RED, -1.0f); // -1 = no fade
+        Flash(0, RED, -1.0f); // -1 = no fade
     };
 
     auto StartShiftRight = [&]()
     {
+        LeavePlayback();
         if (currentAnim != GlobalAnimType::None)
             return;
 
@@ -335,22 +862,69 @@ int main()
         BuildShiftSteps(false, false, 0);
 
         // Symmetric: last index as origin of right shift → stay RED
-        TriggerOverlay(cells[ARRAY_SIZE - 1], RED, -1.0f);
+        Flash(arraySize - 1, RED, -1.0f);
     };
 
 auto StartDeleteAnimation = [&](int fromIndex)
 {
+    LeavePlayback();
     if (currentAnim != GlobalAnimType::None) return;
-    if (fromIndex < 0 || fromIndex >= ARRAY_SIZE) return;
+    if (fromIndex < 0 || fromIndex >= arraySize) return;
 
     currentAnim = GlobalAnimType::Delete;
     ClearAlgorithmVisuals();
     BuildShiftSteps(true, true, fromIndex);
 
     // Just a short flash — don't leave red forever
-    TriggerOverlay(cells[fromIndex], RED, 0.6f);
+    Flash(fromIndex, RED, 0.6f);
 };
 
+    // Switch to another size preset. Values up to the new size are
+    // kept, new slots start empty; any running animation is dropped.
+    auto SetSizePreset = [&](int preset)
+    {
+        if (preset < 0 || preset >= SIZE_PRESET_COUNT)
+            return;
+
+        // Settle any half-played event or shift on the old cells first,
+        // they index the array at its current size
+        EndPlayback();
+        currentAnim       = GlobalAnimType::None;
+        shiftState.active = false;
+        shiftState.steps.clear();
+        ClearAlgorithmVisuals();
+
+        sizePreset = preset;
+        arraySize  = SIZE_PRESETS[preset];
+        cells.resize(arraySize);
+        layout = ComputeLayout(arraySize, GetScreenWidth(), GetScreenHeight());
+
+        selectedIndex = -1;
+        editing       = false;
+        inputBuffer.clear();
+
+        RecomputeValueMax();
+        columnCache.n = -1;
+    };
+
+    // Fill every slot with a random value (typing in a million
+    // values by hand isn't an option)
+    auto FillRandom = [&]()
+    {
+        LeavePlayback();
+
+        int hi = (layout.mode == RenderMode::Boxes) ? 99 : 9999;
+        for (int i = 0; i < arraySize; ++i)
+        {
+            int v = GetRandomValue(1, hi);
+            cells[i].logicalValue = v;
+            cells[i].displayValue = v;
+        }
+        ClearAlgorithmVisuals();
+        RecomputeValueMax();
+        columnCache.n = -1;
+    };
+
     // -------------------------------------------------------------
     // Main loop
     // -------------------------------------------------------------
@@ -359,12 +933,11 @@ auto StartDeleteAnimation = [&](int fromIndex)
         float dt = GetFrameTime();
         Vector2 mouse = GetMousePosition();
 
-        float totalW = ARRAY_SIZE * (boxW + padding) - padding;
-        float startX = GetScreenWidth() / 2.0f - totalW / 2.0f;
-        float y      = GetScreenHeight() * 0.40f;
+        layout = ComputeLayout(arraySize, GetScreenWidth(), GetScreenHeight());
+        float startX = layout.startX;
 
         // Button layout
-        float btnY = y + boxH + 120.0f;
+        float btnY = layout.base + 120.0f;
         float sx   = startX;
 
         Rectangle btnSort   = { sx,          btnY, 140, 60 };
@@ -373,192 +946,299 @@ auto StartDeleteAnimation = [&](int fromIndex)
         Rectangle btnShiftR = { sx + 480.0f, btnY, 140, 60 };
         Rectangle btnReset  = { sx + 640.0f, btnY, 140, 60 };
 
+        Rectangle btnSizeDown = { sx,          btnY + 120.0f, 140, 60 };
+        Rectangle btnSizeUp   = { sx + 160.0f, btnY + 120.0f, 140, 60 };
+        Rectangle btnRandom   = { sx + 320.0f, btnY + 120.0f, 140, 60 };
+        Rectangle btnAlgo     = { sx + 480.0f, btnY + 120.0f, 140, 60 };
+        Rectangle btnParallel = { sx + 640.0f, btnY + 120.0f, 140, 60 };
+
         // ---------------------------------------------------------
         // UPDATE OVERLAYS (fade once, no looping pulses)
         // ---------------------------------------------------------
-        for (int i = 0; i < ARRAY_SIZE; ++i)
+        size_t keep = 0;
+        for (size_t k = 0; k < overlayCells.size(); ++k)
         {
+            int i = overlayCells[k];
             UpdateOverlay(cells[i], dt);
+            if (cells[i].overlayActive)
+                overlayCells[keep++] = i;
         }
+        overlayCells.resize(keep);
 
         // ---------------------------------------------------------
-        // SORT ANIMATION UPDATE (Bubble Sort)
+        // PARALLEL SORT RESULT
         // ---------------------------------------------------------
-        if (currentAnim == GlobalAnimType::Sort && sortState.active)
+        // The cells jump straight to the sorted values, coloured by
+        // the thread that sorted each piece.
+        // ---------------------------------------------------------
+        if (currentAnim == GlobalAnimType::Parallel && parallelRunner.Ready())
+        {
+            ParallelResult& r = parallelRunner.result;
+            for (int i = 0; i < arraySize; ++i)
+            {
+                cells[i].logicalValue = r.sorted[i];
+                cells[i].displayValue = r.sorted[i];
+            }
+            partitionOwner.swap(r.owner);
+            r.sorted.clear();
+            r.sorted.shrink_to_fit();
+
+            columnCache.n = -1;
+            currentAnim   = GlobalAnimType::None;
+        }
+
+        // ---------------------------------------------------------
+        // SORT RECORDING → PLAYBACK
+        // ---------------------------------------------------------
+        SortLog& sortLog = sortRecorder.log;
+
+        if (sortState.recording && sortRecorder.Ready())
+        {
+            sortState.recording = false;
+            sortState.playing   = true;
+            sortState.compares  = sortLog.compares;
+            sortState.swaps     = sortLog.swaps;
+            sortState.writes    = sortLog.writes;
+        }
+
+        bool sortPlayback = (currentAnim == GlobalAnimType::Sort && sortState.active && !sortState.recording);
+        float speed       = (float)PLAYBACK_SPEEDS[sortState.speedIndex];
+
+        // ---------------------------------------------------------
+        // SORT FAST PLAYBACK (Bars / Columns)
+        // ---------------------------------------------------------
+        // No per-event animation: 60 × speed events per second,
+        // highlighting the pair touched last. Stops at either end.
+        // ---------------------------------------------------------
+        if (sortPlayback && sortState.fast && sortState.playing)
         {
             SortState &S = sortState;
 
-            int j  = S.j;
-            int jp = S.j + 1;
-            int n  = S.n;
+            S.owed += 60.0f * speed * dt;
+            int count = (int)S.owed;
+            S.owed -= count;
 
-            // Safety check
-            if (j < 0 || jp >= n)
+            while (count-- > 0)
             {
-                S.active    = false;
-                currentAnim = GlobalAnimType::None;
+                if (S.reverse ? S.position == 0 : S.position == sortLog.events.size())
+                {
+                    S.playing = false;
+                    break;
+                }
+                if (S.reverse)
+                    StepBack();
+                else
+                    StepForward();
             }
-            else
+        }
+
+        // ---------------------------------------------------------
+        // SORT ANIMATION UPDATE (Boxes, event by event)
+        // ---------------------------------------------------------
+        if (sortPlayback && !sortState.fast)
+        {
+            SortState &S = sortState;
+
+            // The frame's (sped-up) time is spent phase by phase: a phase
+            // that finishes hands what's left to the next one, so at high
+            // speeds many events play out in a single frame
+            float budget = dt * speed;
+            auto Spend = [&](float phaseTime)
+            {
+                S.t   += budget / phaseTime;
+                budget = (S.t > 1.0f) ? (S.t - 1.0f) * phaseTime : 0.0f;
+            };
+
+            do
             {
-                // Reset offsets for all non-active cells
-                for (int i = 0; i < ARRAY_SIZE; ++i)
+                // Next event in the play direction
+                if (!S.hasEvent && S.playing)
                 {
-                    if (i != j && i != jp)
+                    if (S.reverse ? S.position == 0 : S.position == sortLog.events.size())
                     {
-                        cells[i].offsetX = 0.0f;
-                        cells[i].offsetY = 0.0f;
+                        S.playing = false;
+                    }
+                    else
+                    {
+                        const LoggedEvent& le = sortLog.events[S.reverse ? S.position - 1 : S.position];
+                        SortEvent prev = S.event;
+                        SortEvent e    = { EventType(le), EventIndex(le), le.b };
+
+                        // A swap right after comparing the same pair starts from the hover
+                        S.lifted = (!S.reverse && cells[e.a].offsetY != 0.0f &&
+                                    prev.type == SortEventType::Compare && e.type == SortEventType::Swap &&
+                                    std::min(prev.a, prev.b) == std::min(e.a, e.b) &&
+                                    std::max(prev.a, prev.b) == std::max(e.a, e.b));
+
+                        S.event    = e;
+                        S.undo     = S.reverse;
+                        S.hasEvent = true;
+                        S.t        = 0.0f;
+
+                        if (e.type == SortEventType::Compare)
+                        {
+                            // Changes nothing, so it counts straight away
+                            S.position += S.undo ? -1 : 1;
+                            ApplyLogged(e.type, e.a, e.b, S.undo);
+                            S.phase = SortState::CompareLift;
+                        }
+                        else if (e.type == SortEventType::Swap)
+                        {
+                            S.phase = SortState::SwapMove;
+                        }
+                        else if (e.type == SortEventType::Write)
+                        {
+                            // New (or, backwards, old) value shows straight away and drops in
+                            cells[e.a].displayValue = cells[e.a].logicalValue ^ e.b;
+                            Flash(e.a, PURPLE, 0.3f);
+                            S.phase = SortState::WriteValue;
+                        }
+                        else
+                        {
+                            S.position += S.undo ? -1 : 1;
+                            ApplyLogged(e.type, e.a, e.b, S.undo);
+                            if (!S.undo)
+                                Flash(e.a, LOCKED_GREEN, 0.7f);
+                            S.hasEvent = false;
+                        }
                     }
                 }
 
-                const float LIFT_TIME     = 0.25f;
-                const float DECISION_TIME = 0.35f;
-                const float SWAP_TIME     = 0.45f;
-                const float POST_TIME     = 0.40f;
-
-                if (S.phase == SortState::CompareLift)
+                if (S.hasEvent)
                 {
-                    S.t += dt / LIFT_TIME;
-                    float e = EaseOutCubic(S.t);
+                    bool pair = (S.event.type == SortEventType::Compare ||
+                                 S.event.type == SortEventType::Swap);
+                    int  j    = S.event.a;
+                    int  jp   = pair ? S.event.b : -1;
 
-                    // Hover both cells up while painting them ORANGE
-                    cells[j ].offsetY = -18.0f * e;
-                    cells[jp].offsetY = -18.0f * e;
-
-                    TriggerOverlay(cells[j ], ORANGE, 0.3f);
-                    TriggerOverlay(cells[jp], ORANGE, 0.3f);
-
-                    if (S.t >= 1.0f)
+                    // Reset offsets for all non-active cells
+                    for (int i = 0; i < arraySize; ++i)
                     {
-                        S.t          = 0.0f;
-                        S.phase      = SortState::CompareDecision;
-                        S.swapNeeded = (cells[j].logicalValue > cells[jp].logicalValue);
+                        if (i != j && i != jp)
+                        {
+                            cells[i].offsetX = 0.0f;
+                            cells[i].offsetY = 0.0f;
+                        }
                     }
-                }
-                else if (S.phase == SortState::CompareDecision)
-                {
-                    S.t += dt / DECISION_TIME;
-                    float e = EaseOutCubic(S.t);
-                    (void)e; // currently unused, but left for tweakable easing
-
-                    // Color logic:
-                    // If left > right → LEFT RED, RIGHT GREEN (swap needed)
-                    // Else (<=)      → both BLUE (stable)
-                    if (S.swapNeeded)
+
+                    const float LIFT_TIME     = 0.25f;
+                    const float DECISION_TIME = 0.35f;
+                    const float SWAP_TIME     = 0.45f;
+                    const float WRITE_TIME    = 0.35f;
+                    const float POST_TIME     = 0.40f;
+
+                    if (S.phase == SortState::CompareLift)
                     {
-                        TriggerOverlay(cells[j ], RED,   0.35f);
-                        TriggerOverlay(cells[jp], GREEN, 0.35f);
+                        Spend(LIFT_TIME);
+                        float e = EaseOutCubic(S.t);
+
+                        // Hover both cells up while painting them ORANGE
+                        cells[j ].offsetY = -18.0f * e;
+                        cells[jp].offsetY = -18.0f * e;
+
+                        Flash(j,  ORANGE, 0.3f);
+                        Flash(jp, ORANGE, 0.3f);
+
+                        if (S.t >= 1.0f)
+                        {
+                            S.t          = 0.0f;
+                            S.phase      = SortState::CompareDecision;
+                            S.swapNeeded = (cells[j].logicalValue > cells[jp].logicalValue);
+                        }
                     }
-                    else
+                    else if (S.phase == SortState::CompareDecision)
                     {
-                        TriggerOverlay(cells[j ], BLUE, 0.35f);
-                        TriggerOverlay(cells[jp], BLUE, 0.35f);
-                    }
+                        Spend(DECISION_TIME);
 
-                    if (S.t >= 1.0f)
-                    {
-                        S.t = 0.0f;
+                        // Color logic:
+                        // If left > right → LEFT RED, RIGHT GREEN (out of order)
+                        // Else (<=)      → both BLUE (stable)
                         if (S.swapNeeded)
                         {
-                            S.phase = SortState::SwapMove;
+                            Flash(j,  RED,   0.35f);
+                            Flash(jp, GREEN, 0.35f);
                         }
                         else
                         {
-                            // No swap → go straight to post step
+                            Flash(j,  BLUE, 0.35f);
+                            Flash(jp, BLUE, 0.35f);
+                        }
+
+                        if (S.t >= 1.0f)
+                        {
+                            S.t     = 0.0f;
                             S.phase = SortState::PostStep;
                         }
                     }
-                }
-                else if (S.phase == SortState::SwapMove)
-                {
-                    S.t += dt / SWAP_TIME;
-                    float e = EaseOutCubic(S.t);
+                    else if (S.phase == SortState::SwapMove)
+                    {
+                        Spend(SWAP_TIME);
+                        float e = EaseOutCubic(S.t);
 
-                    float dx = (boxW + padding);
+                        // Swaps aren't always neighbours (selection, heap, quick)
+                        float dx = layout.pitch * (jp - j);
 
-                    // Animate them horizontally crossing with slight lift down
-                    cells[j ].offsetX =  dx * e;
-                    cells[jp].offsetX = -dx * e;
+                        // Animate them horizontally crossing; from the compare's
+                        // hover back down, or in a small arc when not lifted
+                        cells[j ].offsetX =  dx * e;
+                        cells[jp].offsetX = -dx * e;
 
-                    // Return to baseline vertically
-                    cells[j ].offsetY = -18.0f * (1.0f - e);
-                    cells[jp].offsetY = -18.0f * (1.0f - e);
+                        float lift = S.lifted ? -18.0f * (1.0f - e) : -18.0f * sinf(PI * e);
+                        cells[j ].offsetY = lift;
+                        cells[jp].offsetY = lift;
 
-                    if (S.t >= 1.0f)
-                    {
-                        // Commit the swap of actual values
-                        std::swap(cells[j ].logicalValue, cells[jp].logicalValue);
-                        std::swap(cells[j ].displayValue, cells[jp].displayValue);
-
-                        // Reset offsets back to rest
-                        cells[j ].offsetX = 0.0f;
-                        cells[j ].offsetY = 0.0f;
-                        cells[jp].offsetX = 0.0f;
-                        cells[jp].offsetY = 0.0f;
-
-                        // New position (smaller value) flashes GREEN
-                        // Old position (displaced) flashes RED
-                        TriggerOverlay(cells[j ], GREEN, 0.4f);
-                        TriggerOverlay(cells[jp], RED,   0.4f);
-
-                        S.t     = 0.0f;
-                        S.phase = SortState::PostStep;
-                    }
-                }
-                else if (S.phase == SortState::PostStep)
-                {
-                    S.t += dt / POST_TIME;
+                        if (S.t >= 1.0f)
+                        {
+                            // Commit the swap of actual values
+                            S.position += S.undo ? -1 : 1;
+                            ApplyLogged(S.event.type, j, jp, S.undo);
 
-                    if (S.t >= 1.0f)
-                    {
-                        S.t++;
+                            // Reset offsets back to rest
+                            cells[j ].offsetX = 0.0f;
+                            cells[j ].offsetY = 0.0f;
+                            cells[jp].offsetX = 0.0f;
+                            cells[jp].offsetY = 0.0f;
 
-                        // Advance inner loop
-                        S.j++;
+                            // New position (smaller value) flashes GREEN
+                            // Old position (displaced) flashes RED
+                            Flash(j,  GREEN, 0.4f);
+                            Flash(jp, RED,   0.4f);
 
-                        // If inner loop finished for this pass i
-                        if (S.j >= (n - 1 - S.i))
-                        {
-                            // Element at (n-1-i) is now fixed. Lock it.
-                            int sortedIndex = n - 1 - S.i;
-                            cells[sortedIndex].sortedLocked = true;
-                            TriggerOverlay(cells[sortedIndex], Color{144, 238, 144, 255}, 0.7f); // LIGHT GREEN
-
-                            // Next pass
-                            S.i++;
-                            S.j = 0;
-
-                            if (S.i >= n - 1)
-                            {
-                                // Final element also sorted
-                                cells[0].sortedLocked = true;
-                                TriggerOverlay(cells[0], Color{144, 238, 144, 255}, 0.7f);
-
-                                // Reset all offsets to ensure nothing stays lifted
-                                for (int k = 0; k < ARRAY_SIZE; ++k)
-                                {
-                                    cells[k].offsetX = 0.0f;
-                                    cells[k].offsetY = 0.0f;
-                                }
-
-                                S.active    = false;
-                                currentAnim = GlobalAnimType::None;
-                            }
-                            else
-                            {
-                                // Continue with next comparison
-                                S.phase = SortState::CompareLift;
-                                S.t     = 0.0f;
-                            }
+                            S.t     = 0.0f;
+                            S.phase = SortState::PostStep;
                         }
-                        else
+                    }
+                    else if (S.phase == SortState::WriteValue)
+                    {
+                        Spend(WRITE_TIME);
+                        cells[j].offsetY = -18.0f * (1.0f - EaseOutCubic(S.t));
+
+                        if (S.t >= 1.0f)
                         {
-                            // Not at end of pass yet → go to next pair
-                            S.phase = SortState::CompareLift;
-                            S.t     = 0.0f;
+                            S.position += S.undo ? -1 : 1;
+                            ApplyLogged(S.event.type, j, S.event.b, S.undo);
+                            cells[j].offsetY = 0.0f;
+                            S.hasEvent       = false;
                         }
                     }
+                    else if (S.phase == SortState::PostStep)
+                    {
+                        Spend(POST_TIME);
+
+                        // Pause over → next event
+                        if (S.t >= 1.0f)
+                            S.hasEvent = false;
+                    }
                 }
             }
+            while (budget > 0.0f && (S.hasEvent || S.playing));
+
+            // Stopped (paused or at an end): let a compared pair down
+            if (!S.hasEvent && !S.playing)
+            {
+                for (int i = 0; i < arraySize; ++i)
+                    cells[i].offsetY = 0.0f;
+            }
         }
 
         // ---------------------------------------------------------
@@ -578,13 +1258,14 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 // Special case for delete: last cell becomes 0
                 if (SH.isDelete)
                 {
-                    cells[ARRAY_SIZE - 1].logicalValue = 0;
-                    cells[ARRAY_SIZE - 1].displayValue = 0;
-                    TriggerOverlay(cells[ARRAY_SIZE - 1], DARKGRAY, 0.8f);
+                    cells[arraySize - 1].logicalValue = 0;
+                    cells[arraySize - 1].displayValue = 0;
+                    MarkDirty(columnCache, arraySize - 1, arraySize - 1);
+                    Flash(arraySize - 1, DARKGRAY, 0.8f);
                 }
 
                 // Clear persistent overlays (e.g. the red origin index)
-                for (int i = 0; i < ARRAY_SIZE; ++i)
+                for (int i : overlayCells)
                 {
                     if (cells[i].overlayTimer < 0.0f)
                     {
@@ -597,14 +1278,28 @@ auto StartDeleteAnimation = [&](int fromIndex)
 
                 SH.active    = false;
                 currentAnim  = GlobalAnimType::None;
+                hotA         = -1;
+                hotB         = -1;
 
                 // Make sure all offsets are zero
-                for (int i = 0; i < ARRAY_SIZE; ++i)
+                for (int i = 0; i < arraySize; ++i)
                 {
                     cells[i].offsetX = 0.0f;
                     cells[i].offsetY = 0.0f;
                 }
             }
+            else if (SH.fast)
+            {
+                // Bars/Columns: the whole shift takes FAST_SHIFT_FRAMES frames
+                int budget = std::max(1, (int)SH.steps.size() / FAST_SHIFT_FRAMES);
+                while (budget-- > 0 && SH.currentStep < (int)SH.steps.size())
+                {
+                    SwapStep step = SH.steps[SH.currentStep++];
+                    SwapValues(step.a, step.b);
+                    hotA = step.a;
+                    hotB = step.b;
+                }
+            }
             else
             {
                 // We are in the middle of a neighbour swap
@@ -613,7 +1308,7 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 int b = step.b;
 
                 // Reset offsets each frame, then apply only to active pair
-                for (int i = 0; i < ARRAY_SIZE; ++i)
+                for (int i = 0; i < arraySize; ++i)
                 {
                     cells[i].offsetX = 0.0f;
                     cells[i].offsetY = 0.0f;
@@ -623,11 +1318,11 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 float e = EaseOutCubic(SH.t);
 
                 int dir = (b > a) ? 1 : -1;  // movement direction
-                float dx = (boxW + padding);
+                float dx = layout.pitch;
 
                 // Flash ORANGE on the two cells being swapped
-                TriggerOverlay(cells[a], ORANGE, 0.2f);
-                TriggerOverlay(cells[b], ORANGE, 0.2f);
+                Flash(a, ORANGE, 0.2f);
+                Flash(b, ORANGE, 0.2f);
 
                 // Movement logic: cross horizontally with a small lift
                 cells[a].offsetX =  dx * e * dir;
@@ -638,8 +1333,7 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 if (SH.t >= 1.0f)
                 {
                     // Commit actual values swap
-                    std::swap(cells[a].logicalValue, cells[b].logicalValue);
-                    std::swap(cells[a].displayValue, cells[b].displayValue);
+                    SwapValues(a, b);
 
                     // Reset offsets to rest
                     cells[a].offsetX = 0.0f;
@@ -657,36 +1351,81 @@ auto StartDeleteAnimation = [&](int fromIndex)
         // ---------------------------------------------------------
         // INPUT: Interaction (disabled during algorithm animations)
         // ---------------------------------------------------------
-        bool animationBusy = (currentAnim != GlobalAnimType::None);
+        // A paused sort run counts as idle: the buttons still work
+        // and close it (see LeavePlayback).
+        // ---------------------------------------------------------
+        bool animationBusy = (currentAnim != GlobalAnimType::None) &&
+                             !(currentAnim == GlobalAnimType::Sort && !sortState.playing && !sortState.recording);
 
         // -----------------------------
-        // Click to select a cell
+        // Playback controls for a recorded sort
         // -----------------------------
-        if (!animationBusy && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        if (sortPlayback)
         {
-            bool hit = false;
-            for (int i = 0; i < ARRAY_SIZE; ++i)
+            SortState &S   = sortState;
+            size_t    total = sortLog.events.size();
+
+            if (IsKeyPressed(KEY_R))
+                S.reverse = !S.reverse;
+
+            if (IsKeyPressed(KEY_SPACE))
             {
-                Vector2 basePos  = GetSlotBasePos(i);
-                Rectangle r      = { basePos.x, basePos.y, boxW, boxH };
+                S.playing = !S.playing;
 
-                if (CheckCollisionPointRec(mouse, r))
-                {
-                    selectedIndex = i;
-                    editing       = true;
+                // Play from the end → start over (backwards: from the end)
+                if (S.playing && !S.reverse && S.position == total) SeekTo(0);
+                if (S.playing &&  S.reverse && S.position == 0)     SeekTo(total);
+            }
 
-                    if (cells[i].logicalValue == 0)
-                        inputBuffer.clear();
-                    else
-                        inputBuffer = std::to_string(cells[i].logicalValue);
+            // Single steps pause the run
+            if ((IsKeyPressed(KEY_RIGHT) || IsKeyPressedRepeat(KEY_RIGHT)) && S.position < total)
+            {
+                S.playing = false;
+                SeekTo(S.position + 1);
+            }
+            if ((IsKeyPressed(KEY_LEFT) || IsKeyPressedRepeat(KEY_LEFT)) && S.position > 0)
+            {
+                S.playing = false;
+                SeekTo(S.position - 1);
+            }
 
-                    // Red flash on selection (one-shot, no loop)
-                    TriggerOverlay(cells[i], RED, 0.4f);
+            if (IsKeyPressed(KEY_UP))
+                S.speedIndex = std::min(S.speedIndex + 1, PLAYBACK_SPEED_COUNT - 1);
+            if (IsKeyPressed(KEY_DOWN))
+                S.speedIndex = std::max(S.speedIndex - 1, 0);
 
-                    hit = true;
-                }
+            if (IsKeyPressed(KEY_HOME)) SeekTo(0);
+            if (IsKeyPressed(KEY_END))  SeekTo(total);
+
+            // Drag along the timeline to scrub
+            Rectangle timeline = { startX, layout.base + 40.0f, layout.width, 12.0f };
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(mouse, timeline) && total > 0)
+            {
+                float f = (mouse.x - timeline.x) / timeline.width;
+                SeekTo((size_t)(std::clamp(f, 0.0f, 1.0f) * total + 0.5f));
+            }
+        }
+
+        // -----------------------------
+        // Click to select a cell
+        // -----------------------------
+        if (!animationBusy && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        {
+            int i = HitTest(mouse);
+            if (i != -1)
+            {
+                selectedIndex = i;
+                editing       = true;
+
+                if (cells[i].logicalValue == 0)
+                    inputBuffer.clear();
+                else
+                    inputBuffer = std::to_string(cells[i].logicalValue);
+
+                // Red flash on selection (one-shot, no loop)
+                Flash(i, RED, 0.4f);
             }
-            if (!hit)
+            else
             {
                 selectedIndex = -1;
                 editing       = false;
@@ -720,15 +1459,18 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 if (!inputBuffer.empty())
                     newVal = std::stoi(inputBuffer);
 
-                if (selectedIndex >= 0 && selectedIndex < ARRAY_SIZE)
+                if (selectedIndex >= 0 && selectedIndex < arraySize)
                 {
+                    LeavePlayback();
                     cells[selectedIndex].logicalValue = newVal;
                     cells[selectedIndex].displayValue = newVal;
+                    valueMax = std::max(valueMax, newVal);
+                    MarkDirty(columnCache, selectedIndex, selectedIndex);
 
                     // Small commit highlight
                     lastPressedButton = -2;
                     squishT           = 1.0f;
-                    TriggerOverlay(cells[selectedIndex], GREEN, 0.4f);
+                    Flash(selectedIndex, GREEN, 0.4f);
                 }
 
                 editing       = false;
@@ -738,9 +1480,41 @@ auto StartDeleteAnimation = [&](int fromIndex)
         }
 
         // ---------------------------------------------------------
-        // BUTTON CLICK LOGIC (disabled while algorithms running)
+        // BUTTON CLICK LOGIC
         // ---------------------------------------------------------
-        if (!animationBusy && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        // RESET also works mid-animation: an O(n²) sort over a
+        // million elements would otherwise lock the buttons for good.
+        // Everything else waits for the algorithm to finish.
+        // ---------------------------------------------------------
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(mouse, btnReset))
+        {
+            lastPressedButton = 4;
+            squishT           = 1.0f;
+
+            EndPlayback();
+            parallelRunner.Stop();
+            for (int i = 0; i < arraySize; ++i)
+            {
+                cells[i].logicalValue  = 0;
+                cells[i].displayValue  = 0;
+                cells[i].offsetX       = 0.0f;
+                cells[i].offsetY       = 0.0f;
+                cells[i].overlayActive = false;
+                cells[i].overlayAlpha  = 0.0f;
+                cells[i].overlayTimer  = 0.0f;
+                cells[i].sortedLocked  = false;
+            }
+            overlayCells.clear();
+            partitionOwner.clear();
+            selectedIndex     = -1;
+            editing           = false;
+            inputBuffer.clear();
+            currentAnim       = GlobalAnimType::None;
+            shiftState.active = false;
+            valueMax          = 1;
+            columnCache.n     = -1;
+        }
+        else if (!animationBusy && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
         {
             if (CheckCollisionPointRec(mouse, btnSort))
             {
@@ -773,28 +1547,37 @@ auto StartDeleteAnimation = [&](int fromIndex)
                 squishT           = 1.0f;
                 StartShiftRight();
             }
-            else if (CheckCollisionPointRec(mouse, btnReset))
+            else if (CheckCollisionPointRec(mouse, btnSizeDown))
+            {
+                lastPressedButton = 5;
+                squishT           = 1.0f;
+                SetSizePreset(sizePreset - 1);
+            }
+            else if (CheckCollisionPointRec(mouse, btnSizeUp))
             {
-                lastPressedButton = 4;
+                lastPressedButton = 6;
+                squishT           = 1.0f;
+                SetSizePreset(sizePreset + 1);
+            }
+            else if (CheckCollisionPointRec(mouse, btnRandom))
+            {
+                lastPressedButton = 7;
+                squishT           = 1.0f;
+                FillRandom();
+            }
+            else if (CheckCollisionPointRec(mouse, btnAlgo))
+            {
+                lastPressedButton = 8;
                 squishT           = 1.0f;
 
-                for (int i = 0; i < ARRAY_SIZE; ++i)
-                {
-                    cells[i].logicalValue  = 0;
-                    cells[i].displayValue  = 0;
-                    cells[i].offsetX       = 0.0f;
-                    cells[i].offsetY       = 0.0f;
-                    cells[i].overlayActive = false;
-                    cells[i].overlayAlpha  = 0.0f;
-                    cells[i].overlayTimer  = 0.0f;
-                    cells[i].sortedLocked  = false;
-                }
-                selectedIndex     = -1;
-                editing           = false;
-                inputBuffer.clear();
-                currentAnim       = GlobalAnimType::None;
-                sortState.active  = false;
-                shiftState.active = false;
+                int next = ((int)sortState.algorithm + 1) % (int)SortAlgorithm::Count;
+                sortState.algorithm = (SortAlgorithm)next;
+            }
+            else if (CheckCollisionPointRec(mouse, btnParallel))
+            {
+                lastPressedButton = 9;
+                squishT           = 1.0f;
+                StartParallelSort();
             }
         }
 
@@ -817,67 +1600,186 @@ auto StartDeleteAnimation = [&](int fromIndex)
         DrawText("Click cell → type digits → ENTER to apply",
                  GetScreenWidth()/2 - 240, 110, 22, DARKGRAY);
 
-        bool animationBusyDraw = (currentAnim != GlobalAnimType::None);
+        int hovered = animationBusy ? -1 : HitTest(mouse);
+
+        float boxW = layout.boxW;
+        float boxH = layout.boxH;
 
-        // ----------------------------------
-        // Draw array slots and cell values
-        // ----------------------------------
-        for (int i = 0; i < ARRAY_SIZE; ++i)
+        if (layout.mode == RenderMode::Boxes)
         {
-            Vector2 basePos = GetSlotBasePos(i);
+            // ----------------------------------
+            // Draw array slots and cell values
+            // ----------------------------------
+            int valueFont = std::min(30, (int)(boxW * 0.32f));
+            int indexFont = std::min(20, (int)(boxW * 0.30f));
 
-            float drawX = basePos.x + cells[i].offsetX;
-            float drawY = basePos.y + cells[i].offsetY;
+            for (int i = 0; i < arraySize; ++i)
+            {
+                Vector2 basePos = GetSlotBasePos(i);
 
-            Rectangle r = { drawX, drawY, boxW, boxH };
+                float drawX = basePos.x + cells[i].offsetX;
+                float drawY = basePos.y + cells[i].offsetY;
 
-            // Slot background
-            DrawRectangleRec(r, cells[i].baseColor);
+                Rectangle r = { drawX, drawY, boxW, boxH };
 
-            // Hover outline (only when not animating algorithms)
-            if (!animationBusyDraw && CheckCollisionPointRec(mouse, r))
-                DrawRectangleLinesEx(r, 3, SKYBLUE);
-            else
-                DrawRectangleLinesEx(r, 3, BLACK);
+                // Slot background
+                DrawRectangleRec(r, cells[i].baseColor);
+                if (!partitionOwner.empty())
+                    DrawRectangleRec(r, ColorWithAlpha(PARTITION_COLORS[partitionOwner[i] % PARTITION_COLOR_COUNT], 0.45f));
+
+                // Hover outline (only when not animating algorithms)
+                if (i == hovered)
+                    DrawRectangleLinesEx(r, 3, SKYBLUE);
+                else
+                    DrawRectangleLinesEx(r, 3, BLACK);
+
+                // Overlay highlight (ORANGE/RED/GREEN/BLUE/LIGHTGREEN)
+                if (cells[i].overlayActive && cells[i].overlayAlpha > 0.0f)
+                {
+                    Color c = ColorWithAlpha(cells[i].overlayColor, cells[i].overlayAlpha);
+                    DrawRectangleRec(r, c);
+                    DrawRectangleLinesEx(r, 3, cells[i].overlayColor);
+                }
 
-            // Overlay highlight (ORANGE/RED/GREEN/BLUE/LIGHTGREEN)
-            if (cells[i].overlayActive && cells[i].overlayAlpha > 0.0f)
+                // Index number above the box (does not move)
+                std::string idx = std::to_string(i);
+                DrawText(idx.c_str(),
+                         basePos.x + boxW/2 - MeasureText(idx.c_str(), indexFont)/2,
+                         basePos.y - indexFont - 8,
+                         indexFont,
+                         DARKGRAY);
+
+                // Show either displayValue or current input buffer
+                if (editing && i == selectedIndex)
+                {
+                    std::string str = inputBuffer.empty() ? "" : inputBuffer;
+                    DrawText(str.c_str(),
+                             r.x + boxW/2 - MeasureText(str.c_str(), valueFont)/2,
+                             r.y + boxH/2 - valueFont/2,
+                             valueFont,
+                             BLACK);
+                }
+                else
+                {
+                    int v = cells[i].displayValue;
+                    if (v != 0)
+                    {
+                        std::string val = std::to_string(v);
+                        DrawText(val.c_str(),
+                                 r.x + boxW/2 - MeasureText(val.c_str(), valueFont)/2,
+                                 r.y + boxH/2 - valueFont/2,
+                                 valueFont,
+                                 BLACK);
+                    }
+                }
+            }
+        }
+        else if (layout.mode == RenderMode::Bars)
+        {
+            // ----------------------------------
+            // One bar per element, height ∝ value
+            // ----------------------------------
+            float scale = boxH / valueMax;
+
+            for (int i = 0; i < arraySize; ++i)
             {
-                Color c = ColorWithAlpha(cells[i].overlayColor, cells[i].overlayAlpha);
+                Vector2 basePos = GetSlotBasePos(i);
+                float   h       = std::max(2.0f, cells[i].displayValue * scale);
+
+                Rectangle r = { basePos.x + cells[i].offsetX, layout.base - h, boxW, h };
+
+                Color c = cells[i].sortedLocked ? LOCKED_GREEN : GRAY;
+                if (!partitionOwner.empty())    c = PARTITION_COLORS[partitionOwner[i] % PARTITION_COLOR_COUNT];
+                if (cells[i].displayValue == 0) c = LIGHTGRAY;
+                if (i == hotA || i == hotB)     c = ORANGE;
+                if (i == hovered)               c = SKYBLUE;
+                if (i == selectedIndex)         c = RED;
                 DrawRectangleRec(r, c);
-                DrawRectangleLinesEx(r, 3, cells[i].overlayColor);
+
+                if (cells[i].overlayActive && cells[i].overlayAlpha > 0.0f)
+                    DrawRectangleRec(r, ColorWithAlpha(cells[i].overlayColor, cells[i].overlayAlpha));
+            }
+        }
+        else
+        {
+            // ----------------------------------
+            // Min..max of each pixel column
+            // ----------------------------------
+            int   columns = (int)layout.width;
+            float scale   = boxH / valueMax;
+            RefreshColumns(columnCache, cells, columns);
+
+            for (int c = 0; c < columns; ++c)
+            {
+                int a = (int)((long long)c       * arraySize / columns);
+                int b = (int)((long long)(c + 1) * arraySize / columns) - 1;
+
+                Color col = (cells[a].sortedLocked && cells[b].sortedLocked) ? LOCKED_GREEN : GRAY;
+                if (!partitionOwner.empty())
+                    col = PARTITION_COLORS[partitionOwner[a] % PARTITION_COLOR_COUNT];
+
+                int x   = (int)startX + c;
+                int yHi = (int)(layout.base - columnCache.hi[c] * scale);
+                int yLo = (int)(layout.base - columnCache.lo[c] * scale);
+                DrawLine(x, yHi, x, yLo + 1, col);
             }
 
-            // Index number above the box (does not move)
-            std::string idx = std::to_string(i);
-            DrawText(idx.c_str(),
-                     basePos.x + boxW/2 - MeasureText(idx.c_str(), 20)/2,
-                     basePos.y - 28,
-                     20,
-                     DARKGRAY);
+            // Single elements are sub-pixel here: mark their column instead
+            auto Marker = [&](int i, Color col)
+            {
+                if (i < 0) return;
+                int x = (int)(startX + i * layout.pitch);
+                DrawLine(x, (int)layout.top, x, (int)layout.base, col);
+            };
+            Marker(hotA, ORANGE);
+            Marker(hovered, SKYBLUE);
+            Marker(selectedIndex, RED);
+        }
+
+        // Axis labels: the array is too dense for per-element indices
+        if (layout.mode != RenderMode::Boxes)
+        {
+            std::string last = std::to_string(arraySize - 1);
+            DrawText("0", startX, layout.base + 8, 20, DARKGRAY);
+            DrawText(last.c_str(), startX + layout.width - MeasureText(last.c_str(), 20),
+                     layout.base + 8, 20, DARKGRAY);
+        }
 
-            // Show either displayValue or current input buffer
-            if (editing && i == selectedIndex)
+        // Timeline of the loaded run: drag to scrub
+        if (sortState.active)
+        {
+            float ty = layout.base + 40.0f;
+
+            if (sortState.recording)
             {
-                std::string str = inputBuffer.empty() ? "" : inputBuffer;
-                DrawText(str.c_str(),
-                         r.x + boxW/2 - MeasureText(str.c_str(), 30)/2,
-                         r.y + boxH/2 - 15,
-                         30,
-                         BLACK);
+                DrawText(TextFormat("recording %s ...", SORT_NAMES[(int)sortState.algorithm]),
+                         startX, ty, 20, DARKGRAY);
             }
             else
             {
-                int v = cells[i].displayValue;
-                if (v != 0)
+                size_t total = sortLog.events.size();
+                float  f     = total ? (float)sortState.position / total : 1.0f;
+
+                DrawRectangle((int)startX, (int)ty, (int)layout.width, 12, LIGHTGRAY);
+                DrawRectangle((int)startX, (int)ty, (int)(layout.width * f), 12, DARKBLUE);
+                DrawRectangleLines((int)startX, (int)ty, (int)layout.width, 12, DARKGRAY);
+
+                // Log full: past this mark the cells get their final values directly
+                if (!sortLog.complete && total)
                 {
-                    std::string val = std::to_string(v);
-                    DrawText(val.c_str(),
-                             r.x + boxW/2 - MeasureText(val.c_str(), 30)/2,
-                             r.y + boxH/2 - 15,
-                             30,
-                             BLACK);
+                    int cx = (int)(startX + layout.width * ((float)sortLog.cut / total));
+                    DrawRectangle(cx - 1, (int)ty - 4, 3, 20, RED);
                 }
+
+                const char* state = sortState.playing ? (sortState.reverse ? "rewinding" : "playing")
+                                                      : "paused";
+                std::string note = sortLog.complete ? "" : "   (log full at step " + std::to_string(sortLog.cut) +
+                                                           ", then written straight to sorted)";
+                DrawText(TextFormat("step %zu / %zu   %dx   %s%s", sortState.position, total,
+                                    PLAYBACK_SPEEDS[sortState.speedIndex], state, note.c_str()),
+                         startX, ty + 18, 20, DARKGRAY);
+                DrawText("SPACE play/pause   R reverse   LEFT/RIGHT step   UP/DOWN speed   HOME/END",
+                         startX, ty + 42, 16, GRAY);
             }
         }
 
@@ -918,6 +1820,40 @@ auto StartDeleteAnimation = [&](int fromIndex)
         DrawFancyButton(btnShiftR, PURPLE, "SHIFT R",  2);
         DrawFancyButton(btnReset,  GREEN,  "RESET",    3);
 
+        DrawFancyButton(btnSizeDown, DARKGRAY, "SIZE -", 5);
+        DrawFancyButton(btnSizeUp,   DARKGRAY, "SIZE +", 6);
+        DrawFancyButton(btnRandom,   MAROON,   "RANDOM", 7);
+        DrawFancyButton(btnAlgo,     DARKBLUE, "ALGORITHM", 8);
+        DrawFancyButton(btnParallel, DARKPURPLE, "PARALLEL", 9);
+
+        const char* modeName = (layout.mode == RenderMode::Boxes) ? "boxes"
+                             : (layout.mode == RenderMode::Bars)  ? "bars"
+                                                                  : "min/max columns";
+        DrawText(SORT_NAMES[(int)sortState.algorithm], sx + 800, btnY + 124, 22, DARKBLUE);
+        DrawText(TextFormat("n = %d  (%s)", arraySize, modeName),
+                 sx + 800, btnY + 154, 20, DARKGRAY);
+
+        // Last parallel run against its sequential version
+        const ParallelResult& par = parallelRunner.result;
+        if (currentAnim == GlobalAnimType::Parallel)
+        {
+            DrawText(TextFormat("sorting on %d threads ...", parallelRunner.Threads()),
+                     sx, btnY + 200, 20, DARKGRAY);
+        }
+        else if (par.threads > 0)
+        {
+            DrawText(TextFormat("%s, %d threads:  sequential %.1f ms   parallel %.1f ms   speedup %.2fx",
+                                PARALLEL_NAMES[(int)par.algorithm], par.threads,
+                                par.sequentialMs, par.parallelMs,
+                                par.sequentialMs / std::max(par.parallelMs, 0.001)),
+                     sx, btnY + 200, 20, DARKGRAY);
+        }
+
+        // Event totals of the current / last sort
+        DrawText(TextFormat("compares %lld   swaps %lld   writes %lld",
+                            sortState.compares, sortState.swaps, sortState.writes),
+                 sx + 560, btnY + 80, 20, DARKGRAY);
+
         // =====================================================================
         // Selected info text
         // =====================================================================
@@ -927,11 +1863,14 @@ auto StartDeleteAnimation = [&](int fromIndex)
             DrawText(TextFormat("%d", selectedIndex),
                      startX + 190, btnY + 80, 22, BLACK);
 
+            // Bars/Columns have no room for the text being typed
             int v = cells[selectedIndex].logicalValue;
             const char* valText = (v == 0 ? "(empty)" : TextFormat("%d", v));
+            if (editing && layout.mode != RenderMode::Boxes)
+                valText = TextFormat("%s_", inputBuffer.c_str());
 
-            DrawText("Value:", startX + 260, btnY + 80, 22, DARKGRAY);
-            DrawText(valText, startX + 350, btnY + 80, 22, BLACK);
+            DrawText("Value:", startX + 330, btnY + 80, 22, DARKGRAY);
+            DrawText(valText, startX + 420, btnY + 80, 22, BLACK);
         }
         else
         {
@@ -0,0 +1,207 @@
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "BSTCore.h"
+using namespace std;
+
+// ============================================================
+// BST BENCHMARK (headless, no raylib)
+// ============================================================
+// Times insertKey / searchRecord / removeKey from BSTCore.h on
+// four key orders at 10^3 .. 10^7 keys:
+//
+//   random      → shuffled distinct keys
+//   sorted      → 0, 1, 2, ...     (Plain mode degrades to a list)
+//   zipfian     → keys drawn Zipf(s = 1), so a few hot keys repeat
+//   adversarial → zig-zag lo, hi, lo+1, hi-1, ... (Plain: a long
+//                 zig-zag path; AVL: a rotation on most inserts)
+//
+// Each row reports throughput over the whole phase plus p50/p99 of
+// a sample of single-op latencies (timing every op at 10^7 would
+// mostly measure the clock), and the tree height after inserting.
+//
+// Usage: BSTBenchmark [maxKeys] [avl|plain]
+//   defaults: 10000000 avl. Plain mode skips sorted/adversarial
+//   above 10^4 keys, where it is O(n^2).
+// ============================================================
+
+typedef chrono::steady_clock Clock;
+
+const int LATENCY_SAMPLES = 100000;   // per phase
+
+struct PhaseResult {
+    double mops;
+    double p50;
+    double p99;
+};
+
+// ============================================================
+// KEY GENERATORS
+// ============================================================
+
+vector<int> randomKeys(int n, mt19937& rng) {
+    vector<int> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = i * 4 + (int)(rng() & 3);
+    shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+vector<int> sortedKeys(int n) {
+    vector<int> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = i;
+    return keys;
+}
+
+// Rank r (0-based) is drawn with probability ∝ 1 / (r + 1)
+vector<int> zipfKeys(int n, int count, mt19937& rng) {
+    vector<double> cdf(n);
+    double sum = 0;
+    for (int r = 0; r < n; r++) {
+        sum += 1.0 / (r + 1);
+        cdf[r] = sum;
+    }
+
+    // Scatter ranks over the key space so hot keys aren't all on one side
+    vector<int> keyOfRank = randomKeys(n, rng);
+
+    uniform_real_distribution<double> u(0.0, sum);
+    vector<int> keys(count);
+    for (int i = 0; i < count; i++) {
+        int r = (int)(lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin());
+        keys[i] = keyOfRank[min(r, n - 1)];
+    }
+    return keys;
+}
+
+vector<int> zigZagKeys(int n) {
+    vector<int> keys;
+    keys.reserve(n);
+    int lo = 0, hi = n - 1;
+    while (lo <= hi) {
+        keys.push_back(lo++);
+        if (lo <= hi) keys.push_back(hi--);
+    }
+    return keys;
+}
+
+// ============================================================
+// TIMING
+// ============================================================
+// op(i) runs the i-th operation. Every `stride`-th op is timed on
+// its own for the latency percentiles; the phase as a whole gives
+// the throughput.
+// ============================================================
+
+template <typename Op>
+PhaseResult timePhase(int count, Op op) {
+    int stride = max(1, count / LATENCY_SAMPLES);
+    vector<double> samples;
+    samples.reserve(count / stride + 1);
+
+    auto start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        if (i % stride == 0) {
+            auto t0 = Clock::now();
+            op(i);
+            auto t1 = Clock::now();
+            samples.push_back(chrono::duration<double, nano>(t1 - t0).count());
+        } else {
+            op(i);
+        }
+    }
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    PhaseResult res = {0, 0, 0};
+    if (count == 0) return res;
+
+    res.mops = count / seconds / 1e6;
+    sort(samples.begin(), samples.end());
+    res.p50 = samples[samples.size() / 2];
+    res.p99 = samples[min(samples.size() - 1, samples.size() * 99 / 100)];
+    return res;
+}
+
+void printRow(const char* workload, int n, const char* op, PhaseResult r, int height) {
+    printf("%-12s %9d  %-7s %9.2f %9.0f %9.0f %7d\n",
+           workload, n, op, r.mops, r.p50, r.p99, height);
+}
+
+// ============================================================
+// WORKLOAD
+// ============================================================
+// insert every key, look up `queries` (hits and misses mixed
+// by the workload itself), then remove the keys in insert order.
+// ============================================================
+
+void runWorkload(const char* name, const vector<int>& inserts, const vector<int>& queries) {
+    nodePool.Reset();
+    Node* root = nullptr;
+    vector<Node*> path;
+    long long found = 0;
+    int n = (int)inserts.size();
+
+    PhaseResult ins = timePhase(n, [&](int i) { root = insertKey(root, inserts[i]); });
+    int height = heightOf(root);
+    printRow(name, n, "insert", ins, height);
+
+    PhaseResult sea = timePhase((int)queries.size(), [&](int i) {
+        found += searchRecord(root, queries[i], path) != nullptr;
+    });
+    printRow(name, n, "search", sea, height);
+
+    PhaseResult del = timePhase(n, [&](int i) { root = removeKey(root, inserts[i]); });
+    printRow(name, n, "delete", del, height);
+
+    // Keeps the search loop from being optimised away, and catches
+    // a tree that lost or kept keys it shouldn't have
+    if (found == 0 || root != nullptr)
+        printf("  !! %s: %lld hits, %d keys left after delete\n", name, found, sizeOf(root));
+}
+
+int main(int argc, char** argv) {
+    int maxKeys = 10000000;
+    if (argc > 1) maxKeys = max(1, atoi(argv[1]));
+    if (argc > 2 && strcmp(argv[2], "plain") == 0) balanceMode = BalanceMode::Plain;
+
+    bool plain = (balanceMode == BalanceMode::Plain);
+    mt19937 rng(12345);
+
+    printf("BST benchmark (%s)\n", plain ? "Plain" : "AVL");
+    printf("%-12s %9s  %-7s %9s %9s %9s %7s\n",
+           "workload", "keys", "op", "Mops/s", "p50 ns", "p99 ns", "height");
+
+    for (int n = 1000; n <= maxKeys; n *= 10) {
+        // Queries: keys that are present followed by the same number of misses
+        vector<int> keys = randomKeys(n, rng);
+        vector<int> queries = keys;
+        for (int i = 0; i < n; i++) queries.push_back(-1 - (int)(rng() % 1000000));
+        shuffle(queries.begin(), queries.end(), rng);
+        runWorkload("random", keys, queries);
+
+        if (plain && n > 10000) {
+            printf("%-12s %9d  skipped (O(n^2) in Plain mode)\n", "sorted", n);
+            printf("%-12s %9d  skipped (O(n^2) in Plain mode)\n", "adversarial", n);
+        } else {
+            vector<int> seq = sortedKeys(n);
+            runWorkload("sorted", seq, seq);
+
+            vector<int> zz = zigZagKeys(n);
+            runWorkload("adversarial", zz, zz);
+        }
+
+        // Hot keys: inserts repeat (most become no-ops), lookups skew the same way
+        vector<int> zipf = zipfKeys(n, 2 * n, rng);
+        vector<int> zipfQueries(zipf.begin() + n, zipf.end());
+        zipf.resize(n);
+        runWorkload("zipfian", zipf, zipfQueries);
+
+        printf("\n");
+        if (n > maxKeys / 10) break;
+    }
+
+    return 0;
+}
@@ -0,0 +1,525 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "NodePool.h"
+
+// ============================================================
+// BST CORE (no raylib)
+// ============================================================
+// Node, AVL balancing, insert/remove, bulk load, queries and the
+// Eytzinger lookup array. Shared by the visualizer
+// (BinarySearchTree.cpp) and the headless benchmark
+// (BSTBenchmark.cpp), so tree changes can be timed without a window.
+//
+// Node still carries the visualizer's animation and layout fields;
+// the core only maintains layoutDirty / threads through pull().
+// ============================================================
+
+// ============================================================
+// NODE STRUCT
+// ============================================================
+
+struct Node {
+    int key;
+    Node* left;
+    Node* right;
+    Node* parent;
+
+    int height;          // edges on the longest path down to a leaf (leaf = 0)
+    int size;            // nodes in this subtree, including itself
+
+    float x, y;
+    float targetX, targetY;
+
+    unsigned char alpha;
+    float rotateGlow;    // 1 → just rotated, fades back to 0
+
+    int visitStamp;      // last grid query that collected this node
+    int gridC0, gridR0;  // grid cells the visualizer filed it under
+    int gridC1, gridR1;  //   (gridC0 = -1: not filed)
+
+    int pathStamp;       // == searchStamp → on the current query path
+    int pathIndex;       //   at this step of the animation
+    int hitStamp;        // == searchStamp → part of the query result
+
+    // Tidy-tree layout state (see LAYOUT)
+    bool  layoutDirty;   // subtree shape changed since the last layout
+    bool  layoutMoved;   // childOffset recomputed, absolute pass must descend
+    float childOffset;   // children sit at x - childOffset / x + childOffset
+    Node* thread;        // leaf only: where this subtree's contour continues
+    float threadDx;      // thread->x minus this node's x
+    Node* threadedLeaf;  // leaf this node threaded during its merge (for undo)
+    Node* lmost;         // deepest leftmost / rightmost descendant and
+    Node* rmost;         // their x relative to this node
+    float lmostX, rmostX;
+
+    Node(int k) {
+        key = k;
+        left = right = parent = nullptr;
+        height = 0;
+        size = 1;
+        x = y = 0;
+        targetX = targetY = 0;
+        alpha = 0;
+        rotateGlow = 0;
+        visitStamp = 0;
+        gridC0 = -1;
+        gridR0 = gridC1 = gridR1 = 0;
+        pathStamp = pathIndex = hitStamp = 0;
+        layoutDirty = true;
+        layoutMoved = true;
+        childOffset = 0;
+        thread = threadedLeaf = nullptr;
+        threadDx = 0;
+        lmost = rmost = this;
+        lmostX = rmostX = 0;
+    }
+};
+
+// Bumped on every structural change so cached panel data knows to refresh
+inline int treeVersion = 0;
+
+// Every node comes from the pool; tearing the tree down is nodePool.Reset()
+inline NodePool<Node> nodePool;
+
+// Called just before removeKey hands a node back to the pool, so an
+// index that holds node pointers (the visualizer's grid) can drop it
+inline void (*onNodeDestroy)(Node*) = nullptr;
+
+// ============================================================
+// LAYOUT DIRTY TRACKING
+// ============================================================
+// A node is layoutDirty when its subtree shape changed; the flag is
+// kept closed upward (every ancestor of a dirty node is dirty), so
+// marking stops at the first node that is already dirty.
+//
+// Marking also drops the contour thread the node set during its last
+// merge: that thread is rebuilt on relayout, and leaving it in place
+// could lead a contour walk through nodes that have since moved or
+// been freed.
+// ============================================================
+
+inline void unthread(Node* n) {
+    if (n->threadedLeaf) {
+        n->threadedLeaf->thread = nullptr;
+        n->threadedLeaf = nullptr;
+    }
+}
+
+inline void markLayoutDirty(Node* n) {
+    for (; n && !n->layoutDirty; n = n->parent) {
+        n->layoutDirty = true;
+        unthread(n);
+    }
+}
+
+// ============================================================
+// BALANCING (AVL)
+// ============================================================
+// Plain → classic unbalanced BST (sorted input degrades to a list)
+// AVL   → every insert/remove rebalances on the way back up, so
+//         the height stays O(log n) whatever order keys arrive in.
+// Rotated nodes get rotateGlow = 1 and glide to their new layout
+// slot, which is what animates the rotation on screen.
+//
+// pull() refreshes a node's cached height/size and re-points its
+// children's parent links; every structural change goes through it.
+// ============================================================
+
+enum class BalanceMode { Plain, AVL };
+inline BalanceMode balanceMode = BalanceMode::AVL;
+
+inline int heightOf(Node* n) {
+    return n ? n->height : -1;
+}
+
+inline int sizeOf(Node* n) {
+    return n ? n->size : 0;
+}
+
+inline void pull(Node* n) {
+    n->height = 1 + std::max(heightOf(n->left), heightOf(n->right));
+    n->size   = 1 + sizeOf(n->left) + sizeOf(n->right);
+
+    if (n->left)  n->left->parent  = n;
+    if (n->right) n->right->parent = n;
+
+    markLayoutDirty(n);
+}
+
+inline int balanceFactor(Node* n) {
+    return heightOf(n->left) - heightOf(n->right);
+}
+
+inline Node* rotateRight(Node* y) {
+    Node* x = y->left;
+    y->left = x->right;
+    x->right = y;
+
+    pull(y);
+    pull(x);
+
+    x->rotateGlow = y->rotateGlow = 1.0f;
+    return x;
+}
+
+inline Node* rotateLeft(Node* x) {
+    Node* y = x->right;
+    x->right = y->left;
+    y->left = x;
+
+    pull(x);
+    pull(y);
+
+    x->rotateGlow = y->rotateGlow = 1.0f;
+    return y;
+}
+
+// Returns the node now heading this subtree; its parent link is left
+// for the caller (retrace) to fix.
+inline Node* rebalance(Node* n) {
+    pull(n);
+    if (balanceMode != BalanceMode::AVL) return n;
+
+    int bf = balanceFactor(n);
+
+    // Left heavy (LL / LR)
+    if (bf > 1) {
+        if (balanceFactor(n->left) < 0) n->left = rotateLeft(n->left);
+        return rotateRight(n);
+    }
+
+    // Right heavy (RR / RL)
+    if (bf < -1) {
+        if (balanceFactor(n->right) > 0) n->right = rotateRight(n->right);
+        return rotateLeft(n);
+    }
+
+    return n;
+}
+
+// ============================================================
+// BST LOGIC
+// ============================================================
+// Insert/remove are iterative: go down to the spot, splice, then
+// retrace up the parent links (re-pulling and rebalancing) to the
+// root. No recursion, so even a Plain-mode list is safe.
+// ============================================================
+
+// Re-pull every node from n up to the root; returns the new root.
+inline Node* retrace(Node* n) {
+    Node* top = nullptr;
+
+    while (n) {
+        Node* p = n->parent;
+        bool wasLeft = p && p->left == n;
+
+        Node* sub = rebalance(n);
+        sub->parent = p;
+        if (p) {
+            if (wasLeft) p->left = sub;
+            else p->right = sub;
+        }
+
+        top = sub;
+        n = p;
+    }
+    return top;
+}
+
+inline Node* insertKey(Node* root, int key) {
+    Node* parent = nullptr;
+    Node* cur = root;
+
+    while (cur) {
+        if (key == cur->key) return root;
+        parent = cur;
+        cur = (key < cur->key) ? cur->left : cur->right;
+    }
+
+    Node* n = nodePool.Create(key);
+    n->parent = parent;
+    treeVersion++;
+
+    if (!parent) return n;
+    if (key < parent->key) parent->left = n;
+    else parent->right = n;
+
+    return retrace(parent);
+}
+
+inline Node* findMin(Node* n) {
+    while (n && n->left) n = n->left;
+    return n;
+}
+
+inline Node* removeKey(Node* root, int key) {
+    Node* n = root;
+    while (n && n->key != key)
+        n = (key < n->key) ? n->left : n->right;
+    if (!n) return root;
+
+    // Two children → take the successor's key, unlink the successor
+    if (n->left && n->right) {
+        Node* s = findMin(n->right);
+        n->key = s->key;
+        n = s;
+    }
+
+    // Undo threads that may point at n while its ancestors are still linked
+    markLayoutDirty(n);
+
+    Node* child = n->left ? n->left : n->right;
+    Node* p = n->parent;
+    if (child) child->parent = p;
+
+    if (p) {
+        if (p->left == n) p->left = child;
+        else p->right = child;
+    }
+
+    if (onNodeDestroy) onNodeDestroy(n);
+    nodePool.Destroy(n);
+    treeVersion++;
+
+    return p ? retrace(p) : child;
+}
+
+// ============================================================
+// BULK LOAD
+// ============================================================
+// buildFromSorted turns strictly increasing keys into a perfectly
+// balanced tree in O(n): the middle key becomes the root, each half
+// becomes a subtree. Recursion depth is only log2(n).
+// bulkLoad optionally sorts + dedupes arbitrary input first
+// (O(n log n), only for the sort).
+// ============================================================
+
+inline Node* buildRange(const std::vector<int>& keys, int lo, int hi) {
+    if (lo > hi) return nullptr;
+
+    int mid = lo + (hi - lo) / 2;
+    Node* n = nodePool.Create(keys[mid]);
+    n->left  = buildRange(keys, lo, mid - 1);
+    n->right = buildRange(keys, mid + 1, hi);
+    pull(n);
+    return n;
+}
+
+// Replaces the whole tree; keys must be sorted and unique
+inline Node* buildFromSorted(const std::vector<int>& keys) {
+    nodePool.Reset();
+    treeVersion++;
+    return buildRange(keys, 0, (int)keys.size() - 1);
+}
+
+inline Node* bulkLoad(std::vector<int> keys, bool sortAndDedupe) {
+    if (sortAndDedupe) {
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+    return buildFromSorted(keys);
+}
+
+// Rebuild the current tree balanced (used when the mode is switched
+// so an existing degenerate tree gets fixed). The in-order walk uses
+// an explicit stack so a list-shaped tree is safe.
+inline void collectKeys(Node* n, std::vector<int>& keys) {
+    keys.clear();
+    std::vector<Node*> stack;
+    Node* cur = n;
+
+    while (cur || !stack.empty()) {
+        while (cur) { stack.push_back(cur); cur = cur->left; }
+        cur = stack.back(); stack.pop_back();
+        keys.push_back(cur->key);
+        cur = cur->right;
+    }
+}
+
+inline Node* rebuildTree(Node* n) {
+    std::vector<int> keys;
+    collectKeys(n, keys);
+    return buildFromSorted(keys);
+}
+
+// Path of visited nodes goes into `path` (the search animation)
+inline Node* searchRecord(Node* n, int key, std::vector<Node*>& path) {
+    path.clear();
+    Node* cur = n;
+
+    while (cur) {
+        path.push_back(cur);
+        if (cur->key == key) return cur;
+        if (key < cur->key) cur = cur->left;
+        else cur = cur->right;
+    }
+    return nullptr;
+}
+
+// ============================================================
+// ORDER STATISTICS
+// ============================================================
+// Cached subtree sizes turn the BST into an order-statistic tree:
+//   rankQuery   → how many keys < key            O(log n)
+//   selectQuery → k-th smallest key (1-based)    O(log n)
+//   rangeQuery  → every key in [lo, hi]          O(log n + k)
+// Each fills `path` with the nodes it touched, in visit order, so
+// the search animation can replay the (pruned) traversal.
+// ============================================================
+
+inline int rankQuery(Node* n, int key, std::vector<Node*>& path) {
+    path.clear();
+    int rank = 0;
+
+    while (n) {
+        path.push_back(n);
+        if (key <= n->key) {
+            n = n->left;
+        } else {
+            rank += sizeOf(n->left) + 1;
+            n = n->right;
+        }
+    }
+    return rank;
+}
+
+inline Node* selectQuery(Node* n, int k, std::vector<Node*>& path) {
+    path.clear();
+
+    while (n) {
+        path.push_back(n);
+        int leftSize = sizeOf(n->left);
+
+        if (k <= leftSize) {
+            n = n->left;
+        } else if (k == leftSize + 1) {
+            return n;
+        } else {
+            k -= leftSize + 1;
+            n = n->right;
+        }
+    }
+    return nullptr;
+}
+
+// In-order walk that never enters a subtree lying outside [lo, hi]
+inline void rangeQuery(Node* n, int lo, int hi, std::vector<Node*>& path, std::vector<Node*>& hits) {
+    path.clear();
+    hits.clear();
+    std::vector<Node*> stack;
+
+    while (n || !stack.empty()) {
+        while (n) {
+            path.push_back(n);
+            stack.push_back(n);
+            n = (n->key > lo) ? n->left : nullptr;
+        }
+
+        n = stack.back();
+        stack.pop_back();
+
+        if (n->key >= lo && n->key <= hi) hits.push_back(n);
+        n = (n->key < hi) ? n->right : nullptr;
+    }
+}
+
+// ============================================================
+// EYTZINGER ARRAY (cache-friendly static search)
+// ============================================================
+// A snapshot of the keys stored in BFS order: slot 1 is the root,
+// the children of slot k are 2k and 2k+1. The top levels of every
+// search share the first few cache lines, and one prefetch covers
+// four levels ahead (16 ints = one 64-byte line), so lookups stop
+// paying a cache miss per level like the Node pointer chase does.
+//
+// The search loop is branch-free: the comparison result is added
+// to the index instead of choosing a branch. It ends past the
+// leaves; stripping the trailing right turns (1-bits) plus one
+// more bit gives the slot of the first key >= the target.
+//
+// Rebuilt lazily whenever treeVersion changes. A van Emde Boas
+// layout is left out: with prefetching the Eytzinger order is
+// already as fast for int keys and far simpler to build.
+// ============================================================
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)0)
+#endif
+
+struct EytzingerIndex {
+    std::vector<int> slots;     // slots[0] unused, 1..n hold keys
+    int n = 0;
+    int version = -1;           // treeVersion the snapshot was taken at
+};
+
+inline EytzingerIndex eytz;
+
+// In-order fill: the i-th smallest key lands at the i-th in-order slot
+inline int fillEytzinger(const std::vector<int>& sorted, int i, int k) {
+    if (k <= eytz.n) {
+        i = fillEytzinger(sorted, i, 2 * k);
+        eytz.slots[k] = sorted[i++];
+        i = fillEytzinger(sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+inline void refreshEytzinger(Node* root) {
+    if (eytz.version == treeVersion) return;
+
+    std::vector<int> sorted;
+    collectKeys(root, sorted);
+
+    eytz.n = (int)sorted.size();
+    eytz.slots.assign(eytz.n + 1, 0);
+    fillEytzinger(sorted, 0, 1);
+    eytz.version = treeVersion;
+}
+
+// Slot of the first key >= key, 0 if every key is smaller
+inline int eytzingerLowerBound(int key) {
+    const int* a = eytz.slots.data();
+    size_t k = 1;
+
+    while (k <= (size_t)eytz.n) {
+        PREFETCH(a + std::min(k * 16, (size_t)eytz.n));
+        k = 2 * k + (a[k] < key);
+    }
+
+    while (k & 1) k >>= 1;
+    return (int)(k >> 1);
+}
+
+inline bool eytzingerContains(int key) {
+    int k = eytzingerLowerBound(key);
+    return k != 0 && eytz.slots[k] == key;
+}
+
+// Same walk as eytzingerLowerBound, but keeps the slots it touched
+inline bool eytzingerProbe(int key, std::vector<int>& probes) {
+    probes.clear();
+    size_t k = 1;
+
+    while (k <= (size_t)eytz.n) {
+        probes.push_back((int)k);
+        k = 2 * k + (eytz.slots[k] < key);
+    }
+
+    while (k & 1) k >>= 1;
+    k >>= 1;
+    return k != 0 && eytz.slots[k] == key;
+}
+
+// Plain pointer-chasing lookup (searchRecord without the path)
+inline bool treeContains(Node* n, int key) {
+    while (n) {
+        if (key == n->key) return true;
+        n = (key < n->key) ? n->left : n->right;
+    }
+    return false;
+}
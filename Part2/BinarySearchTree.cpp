@@ -1,40 +1,23 @@
 #include "raylib.h"
+#include "rlgl.h"
 #include <iostream>
 #include <vector>
 #include <cmath>
 #include <ctime>
 #include <algorithm>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include "BSTCore.h"
 using namespace std;
 
 // ============================================================
-// NODE STRUCT
+// GLOBALS (TREE, SELECTION, SEARCH, DELETE, VISUALIZE, CAMERA)
 // ============================================================
-
-struct Node {
-    int key;
-    Node* left;
-    Node* right;
-
-    float x, y;
-    float targetX, targetY;
-
-    unsigned char alpha;
-
-    Node(int k) {
-        key = k;
-        left = right = nullptr;
-        x = y = 0;
-        targetX = targetY = 0;
-        alpha = 0;
-    }
-};
+// Tree logic itself (Node, AVL, queries) lives in BSTCore.h.
 
 Node* root = nullptr;
 
-// ============================================================
-// GLOBALS (SELECTION, SEARCH, DELETE, VISUALIZE, CAMERA)
-// ============================================================
-
 Node* selectedNode = nullptr;
 Node* deleteTargetNode = nullptr;
 
@@ -50,9 +33,23 @@ int searchIndex = -1;
 bool searchActive = false;
 bool searchFound = false;
 
+// ---- QUERIES (rank / select / range reuse the search animation) ----
+enum class QueryKind { Search, Rank, Select, Range };
+QueryKind queryKind = QueryKind::Search;
+int searchStamp = 1;          // bumped per query, see Node::pathStamp
+float searchStepTime = 0.5f;  // shorter for long paths (range scans)
+char queryStatus[96] = "";     // last query result, shown above the status bar
+
+// Datasets and benchmark queries: GetRandomValue is rand() % range,
+// which tops out at RAND_MAX (32767 on MSVC)
+mt19937 keyRng;
+
+vector<int> eytzProbes;       // array slots the last search touched (BSTCore.h EYTZINGER)
+
 // ---- CAMERA ----
 float camZoom = 1.0f;
 float camZoomTarget = 1.0f;
+Vector2 camTarget = {700, 200};
 
 // ---- VISUALIZE ----
 vector<int> visualizeSeq;
@@ -71,98 +68,487 @@ Vector2 ScreenToWorld(Camera2D cam, Vector2 screenPos) {
 }
 
 // ============================================================
-// BST LOGIC
+// QUERY ANIMATION
 // ============================================================
 
-Node* insertRec(Node* n, int key) {
-    if (!n) return new Node(key);
-    if (key < n->key) n->left = insertRec(n->left, key);
-    else if (key > n->key) n->right = insertRec(n->right, key);
-    return n;
+// Stamp the current searchPath/hits and start the step animation
+void beginPathAnimation(QueryKind kind, const vector<Node*>& hits) {
+    searchStamp++;
+
+    for (int i = 0; i < (int)searchPath.size(); i++) {
+        searchPath[i]->pathStamp = searchStamp;
+        searchPath[i]->pathIndex = i;
+    }
+    for (Node* h : hits) h->hitStamp = searchStamp;
+
+    queryKind = kind;
+    searchActive = true;
+    searchTimer = 0;
+    searchIndex = -1;
+    searchStepTime = min(0.5f, 6.0f / max(1, (int)searchPath.size()));
 }
 
-Node* findMin(Node* n) {
-    while (n && n->left) n = n->left;
-    return n;
+// ============================================================
+// LOOKUP BENCHMARK (pointer BST vs Eytzinger array)
+// ============================================================
+// Same random queries (half hits, half misses) against both
+// structures, reported as ns per lookup.
+// ============================================================
+struct LookupBench {
+    bool valid = false;
+    int keys = 0;
+    double treeNs = 0;
+    double arrayNs = 0;
+};
+
+LookupBench lookupBench;
+
+void runLookupBench(Node* root, int queries) {
+    refreshEytzinger(root);
+    lookupBench = LookupBench();
+    if (eytz.n == 0) return;
+
+    // Drawn up front so the timed loops only do lookups
+    uniform_int_distribution<int> anyKey(0, 2000000000);
+    uniform_int_distribution<int> anySlot(1, eytz.n);
+    vector<int> q(queries);
+    for (int i = 0; i < queries; i++)
+        q[i] = (i & 1) ? anyKey(keyRng) : eytz.slots[anySlot(keyRng)];
+
+    using Clock = chrono::steady_clock;
+    int hits = 0;
+
+    auto t0 = Clock::now();
+    for (int key : q) hits += treeContains(root, key);
+    auto t1 = Clock::now();
+    for (int key : q) hits += eytzingerContains(key);
+    auto t2 = Clock::now();
+
+    lookupBench.valid   = hits > 0;   // also keeps the loops from being optimised out
+    lookupBench.keys    = eytz.n;
+    lookupBench.treeNs  = chrono::duration<double, nano>(t1 - t0).count() / queries;
+    lookupBench.arrayNs = chrono::duration<double, nano>(t2 - t1).count() / queries;
 }
 
-Node* removeRec(Node* n, int key) {
-    if (!n) return nullptr;
+// ============================================================
+// TRAVERSAL (explicit stack, no recursion)
+// ============================================================
+// Every per-frame pass walks the tree with its own stack vector
+// instead of the call stack, so a degenerate (list-shaped) tree of
+// 100k+ nodes can't overflow it.
+// ============================================================
 
-    if (key < n->key) n->left = removeRec(n->left, key);
-    else if (key > n->key) n->right = removeRec(n->right, key);
-    else {
-        if (!n->left && !n->right) { delete n; return nullptr; }
-        if (!n->left) { Node* r = n->right; delete n; return r; }
-        if (!n->right) { Node* l = n->left; delete n; return l; }
+template <typename Visit>
+void forEachPreorder(Node* root, Visit visit) {
+    if (!root) return;
 
-        Node* s = findMin(n->right);
-        n->key = s->key;
-        n->right = removeRec(n->right, s->key);
+    vector<Node*> stack;
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+        Node* n = stack.back();
+        stack.pop_back();
+
+        visit(n);
+
+        if (n->right) stack.push_back(n->right);
+        if (n->left)  stack.push_back(n->left);
     }
-    return n;
 }
 
-Node* searchRecord(Node* n, int key) {
-    searchPath.clear();
-    Node* cur = n;
+// ============================================================
+// SPATIAL INDEX (uniform grid over layout targets)
+// ============================================================
+// Each node is filed under every cell its disc or its incoming edge
+// (parent → node) touches, which lets one rectangle query return
+// everything needed to draw a view.
+//
+// A bulk load builds the grid in one go: cells are stored compressed
+// (cellStart offsets into one items array) and the column count is
+// capped at ~4 cells per node, so a very wide tree doesn't allocate
+// a huge empty grid.
+//
+// After that, edits keep it valid. Whenever the layout job sets a
+// node's target, fileNode compares the node's cell range with the
+// one it was filed under (gridC0..gridR1 on the node) and appends
+// entries for the new cells to a per-cell chain (extraHead → extra).
+// Entries are never removed: a query skips any entry whose cell is
+// outside the node's current range, and visitStamp drops repeats.
+// A deleted node is unfiled (gridC0 = -1), so its entries all go
+// stale. Once the chains outgrow the compressed part, or too many
+// nodes have spilled past the grid's edge, the next finished job
+// rebuilds it.
+// ============================================================
 
-    while (cur) {
-        searchPath.push_back(cur);
-        if (cur->key == key) return cur;
-        if (key < cur->key) cur = cur->left;
-        else cur = cur->right;
+const float NODE_RADIUS = 24.0f;
+const float GRID_CELL_H = 80.0f;   // one tree level per row
+
+struct GridEntry {
+    Node* n;
+    int next;                  // next entry in this cell's chain, -1 = end
+};
+
+struct SpatialGrid {
+    bool  valid = false;
+    float minX = 0, minY = 0;
+    float cellW = 1, cellH = GRID_CELL_H;
+    int   cols = 0, rows = 0;
+
+    vector<int>   cellStart;   // cols*rows + 1 offsets into items
+    vector<Node*> items;
+
+    vector<int>       extraHead;   // per cell, first entry filed since the build
+    vector<GridEntry> extra;
+    int spilled = 0;           // filings that reached past the grid's edge
+
+    int stamp = 0;             // bumped per query (dedupes multi-cell nodes)
+};
+
+SpatialGrid grid;
+
+Rectangle nodeBounds(Node* n) {
+    float x0 = n->targetX - NODE_RADIUS, x1 = n->targetX + NODE_RADIUS;
+    float y0 = n->targetY - NODE_RADIUS, y1 = n->targetY + NODE_RADIUS;
+
+    if (n->parent) {
+        x0 = min(x0, n->parent->targetX);
+        x1 = max(x1, n->parent->targetX);
+        y0 = min(y0, n->parent->targetY);
     }
-    return nullptr;
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// Cell range covered by a world rectangle, clamped to the grid: a
+// rectangle past an edge maps to the border cells, so nodes that
+// moved off the grid are still found there. Returns false if it was
+// clamped.
+bool gridCellRange(Rectangle r, int& c0, int& r0, int& c1, int& r1) {
+    float fc0 = floorf((r.x - grid.minX) / grid.cellW);
+    float fr0 = floorf((r.y - grid.minY) / grid.cellH);
+    float fc1 = floorf((r.x + r.width  - grid.minX) / grid.cellW);
+    float fr1 = floorf((r.y + r.height - grid.minY) / grid.cellH);
+
+    c0 = (int)min(max(fc0, 0.0f), (float)(grid.cols - 1));
+    r0 = (int)min(max(fr0, 0.0f), (float)(grid.rows - 1));
+    c1 = (int)min(max(fc1, 0.0f), (float)(grid.cols - 1));
+    r1 = (int)min(max(fr1, 0.0f), (float)(grid.rows - 1));
+    return fc0 >= 0 && fr0 >= 0 && fc1 < grid.cols && fr1 < grid.rows;
 }
 
+void buildSpatialGrid(Node* root) {
+    grid.valid = false;
+    grid.items.clear();
+    grid.extra.clear();
+    grid.spilled = 0;
+    if (!root) return;
+
+    // Extent of everything that will be filed
+    float minX = 1e30f, minY = 1e30f, maxX = -1e30f, maxY = -1e30f;
+    int count = 0;
+    forEachPreorder(root, [&](Node* n) {
+        Rectangle b = nodeBounds(n);
+        minX = min(minX, b.x);  maxX = max(maxX, b.x + b.width);
+        minY = min(minY, b.y);  maxY = max(maxY, b.y + b.height);
+        count++;
+    });
+
+    grid.minX  = minX;
+    grid.minY  = minY;
+    grid.cellH = GRID_CELL_H;
+    grid.rows  = (int)((maxY - minY) / grid.cellH) + 1;
+    grid.cols  = max(1, min((int)((maxX - minX) / 64.0f) + 1, (4 * count + 16) / grid.rows));
+    grid.cellW = max(64.0f, (maxX - minX) / grid.cols + 1.0f);
+
+    // Pass 1: count entries per cell (and note each node's range),
+    // pass 2: scatter into place
+    grid.cellStart.assign(grid.cols * grid.rows + 1, 0);
+    grid.extraHead.assign(grid.cols * grid.rows, -1);
+    forEachPreorder(root, [&](Node* n) {
+        gridCellRange(nodeBounds(n), n->gridC0, n->gridR0, n->gridC1, n->gridR1);
+        for (int r = n->gridR0; r <= n->gridR1; r++)
+            for (int c = n->gridC0; c <= n->gridC1; c++)
+                grid.cellStart[r * grid.cols + c + 1]++;
+    });
+
+    for (size_t i = 1; i < grid.cellStart.size(); i++)
+        grid.cellStart[i] += grid.cellStart[i - 1];
+
+    grid.items.resize(grid.cellStart.back());
+    vector<int> fill(grid.cellStart.begin(), grid.cellStart.end() - 1);
+    forEachPreorder(root, [&](Node* n) {
+        for (int r = n->gridR0; r <= n->gridR1; r++)
+            for (int c = n->gridC0; c <= n->gridC1; c++)
+                grid.items[fill[r * grid.cols + c]++] = n;
+    });
+
+    grid.valid = true;
+}
+
+// Re-file n after its target (or its parent's) may have changed:
+// only cells it didn't already cover get a new entry
+void fileNode(Node* n) {
+    int c0, r0, c1, r1;
+    if (!gridCellRange(nodeBounds(n), c0, r0, c1, r1)) grid.spilled++;
+    if (c0 == n->gridC0 && r0 == n->gridR0 && c1 == n->gridC1 && r1 == n->gridR1) return;
+
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            bool had = n->gridC0 >= 0 && c >= n->gridC0 && c <= n->gridC1 && r >= n->gridR0 && r <= n->gridR1;
+            if (had) continue;
+
+            int cell = r * grid.cols + c;
+            grid.extra.push_back({n, grid.extraHead[cell]});
+            grid.extraHead[cell] = (int)grid.extra.size() - 1;
+        }
+    }
+    n->gridC0 = c0;  n->gridR0 = r0;
+    n->gridC1 = c1;  n->gridR1 = r1;
+}
+
+// onNodeDestroy hook: every entry for n goes stale. The pool keeps
+// the memory, so stale entries stay safe to read; if the slot is
+// reused, the new node starts unfiled.
+void unfileNode(Node* n) {
+    n->gridC0 = -1;
+}
+
+// Chains have outgrown the compressed cells, or the tree has grown
+// well past the grid's edges → rebuild when the current job ends
+bool gridWorn(int count) {
+    return grid.extra.size() > grid.items.size() + 65536 || grid.spilled > count / 8 + 256;
+}
+
+// Every node whose disc or incoming edge may touch `area`
+void queryGrid(Rectangle area, vector<Node*>& out) {
+    out.clear();
+    if (!grid.valid || grid.cols == 0) return;
+
+    int c0, r0, c1, r1;
+    gridCellRange(area, c0, r0, c1, r1);
+    int stamp = ++grid.stamp;
+
+    auto take = [&](Node* n, int c, int r) {
+        if (n->visitStamp == stamp) return;
+        if (n->gridC0 < 0 || c < n->gridC0 || c > n->gridC1 || r < n->gridR0 || r > n->gridR1) return;
+        n->visitStamp = stamp;
+        out.push_back(n);
+    };
+
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            int cell = r * grid.cols + c;
+            for (int i = grid.cellStart[cell]; i < grid.cellStart[cell + 1]; i++)
+                take(grid.items[i], c, r);
+            for (int e = grid.extraHead[cell]; e >= 0; e = grid.extra[e].next)
+                take(grid.extra[e].n, c, r);
+        }
+    }
+}
+
+// ============================================================
+// LAYOUT (Reingold–Tilford tidy tree)
 // ============================================================
-// LAYOUT
+// Two passes:
+//
+// 1. Relative pass (tidyRelayout, post-order, dirty nodes only).
+//    For each node the right contour of its left subtree and the
+//    left contour of its right subtree are walked level by level and
+//    pushed apart until no level is closer than MIN_SEP. The result
+//    is childOffset: children sit at x ∓ childOffset. Clean subtrees
+//    keep their old result, so after an insert/delete only the
+//    changed path (plus rotated nodes) is merged again.
+//
+//    Contours are followed in linear time with threads: when one
+//    subtree is shallower, its deepest extreme leaf gets a thread to
+//    the next contour node of the deeper side.
+//
+// 2. Absolute pass (computeLayout/stepLayout, pre-order, budgeted).
+//    Turns offsets into targetX/targetY. A subtree is skipped when
+//    its root kept both its target and its childOffset.
 // ============================================================
 
-void computeLayout(Node* n, float x, float y, float spacing) {
-    if (!n) return;
+const float ROOT_X    = 700.0f;
+const float ROOT_Y    = 120.0f;
+const float LEVEL_GAP = 80.0f;
+const float MIN_SEP   = 60.0f;   // closest two nodes on one level may get
 
-    n->targetX = x;
-    n->targetY = y;
+void tidyMerge(Node* t) {
+    Node* L = t->left;
+    Node* R = t->right;
 
-    computeLayout(n->left,  x - spacing, y + 80, spacing * 0.5f);
-    computeLayout(n->right, x + spacing, y + 80, spacing * 0.5f);
+    if (!L && !R) {
+        t->childOffset = 0;
+        t->lmost = t->rmost = t;
+        t->lmostX = t->rmostX = 0;
+        return;
+    }
+
+    // sep = x(r) - x(l) on the current level, assuming the children
+    // start rootSep apart; lx / rx are relative to L / R.
+    float rootSep = MIN_SEP, sep = MIN_SEP;
+    float lx = 0, rx = 0;
+    Node* l = L;
+    Node* r = R;
+
+    while (l && r) {
+        if (sep < MIN_SEP) {
+            rootSep += MIN_SEP - sep;
+            sep = MIN_SEP;
+        }
+
+        // l follows the right contour of L
+        if (l->right)     { lx += l->childOffset; sep -= l->childOffset; l = l->right; }
+        else if (l->left) { lx -= l->childOffset; sep += l->childOffset; l = l->left; }
+        else              { lx += l->threadDx;    sep -= l->threadDx;    l = l->thread; }
+
+        // r follows the left contour of R
+        if (r->left)       { rx -= r->childOffset; sep -= r->childOffset; r = r->left; }
+        else if (r->right) { rx += r->childOffset; sep += r->childOffset; r = r->right; }
+        else               { rx += r->threadDx;    sep += r->threadDx;    r = r->thread; }
+    }
+
+    float off = rootSep / 2;
+    t->childOffset = off;
+    lx -= off;
+    rx += off;
+
+    // Deepest extremes (both sit on the deepest level, height below t)
+    if (!L || (R && R->height > L->height)) { t->lmost = R->lmost; t->lmostX = R->lmostX + off; }
+    else                                    { t->lmost = L->lmost; t->lmostX = L->lmostX - off; }
+
+    if (!R || (L && L->height > R->height)) { t->rmost = L->rmost; t->rmostX = L->rmostX - off; }
+    else                                    { t->rmost = R->rmost; t->rmostX = R->rmostX + off; }
+
+    // Thread the shallower side's extreme leaf into the deeper contour
+    if (L && R && l) {
+        Node* leaf = R->rmost;
+        leaf->thread = l;
+        leaf->threadDx = lx - (R->rmostX + off);
+        t->threadedLeaf = leaf;
+    } else if (L && R && r) {
+        Node* leaf = L->lmost;
+        leaf->thread = r;
+        leaf->threadDx = rx - (L->lmostX - off);
+        t->threadedLeaf = leaf;
+    }
+}
+
+void tidyRelayout(Node* root) {
+    if (!root || !root->layoutDirty) return;
+
+    vector<pair<Node*, bool>> stack;   // (node, children done)
+    stack.push_back({root, false});
+
+    while (!stack.empty()) {
+        auto [n, childrenDone] = stack.back();
+        stack.pop_back();
+
+        if (childrenDone) {
+            tidyMerge(n);
+            n->layoutDirty = false;
+            n->layoutMoved = true;
+            continue;
+        }
+
+        stack.push_back({n, true});
+        if (n->right && n->right->layoutDirty) stack.push_back({n->right, false});
+        if (n->left  && n->left->layoutDirty)  stack.push_back({n->left,  false});
+    }
+}
+
+struct LayoutFrame {
+    Node* n;
+    float x;
+    int depth;
+};
+
+vector<LayoutFrame> layoutStack;
+Node* layoutRoot = nullptr;
+bool layoutFull = false;   // previous absolute pass was cut short → visit everything
+
+const int LAYOUT_BUDGET = 20000;
+
+void computeLayout(Node* n) {
+    if (!layoutStack.empty()) layoutFull = true;
+
+    tidyRelayout(n);
+
+    layoutStack.clear();
+    layoutRoot = n;
+    if (n) layoutStack.push_back({n, ROOT_X, 0});
+}
+
+void stepLayout(int budget) {
+    while (budget-- > 0 && !layoutStack.empty()) {
+        LayoutFrame f = layoutStack.back();
+        layoutStack.pop_back();
+
+        Node* n = f.n;
+        float y = ROOT_Y + f.depth * LEVEL_GAP;
+
+        bool unchanged = !n->layoutMoved && n->targetX == f.x && n->targetY == y;
+        if (!unchanged || layoutFull) {
+            n->targetX = f.x;
+            n->targetY = y;
+            n->layoutMoved = false;
+
+            if (n->right) layoutStack.push_back({n->right, f.x + n->childOffset, f.depth + 1});
+            if (n->left)  layoutStack.push_back({n->left,  f.x - n->childOffset, f.depth + 1});
+        }
+
+        // Visited even when unchanged: its parent moved, or is new
+        if (grid.valid) fileNode(n);
+
+        // Job just finished → full index only after a bulk load
+        if (layoutStack.empty()) {
+            layoutFull = false;
+            if (!grid.valid || gridWorn(sizeOf(layoutRoot))) buildSpatialGrid(layoutRoot);
+        }
+    }
 }
 
 // ============================================================
 // ANIMATION
 // ============================================================
 
-void updatePositions(Node* n) {
-    if (!n) return;
-
+void animateNode(Node* n) {
     if (n->alpha < 255) n->alpha += 4;
+    if (n->rotateGlow > 0) n->rotateGlow -= 0.02f;
 
     n->x += (n->targetX - n->x) * 0.15f;
     n->y += (n->targetY - n->y) * 0.15f;
-
-    updatePositions(n->left);
-    updatePositions(n->right);
 }
 
 // ============================================================
 // INFO PANEL HELPERS
 // ============================================================
 
-Node* findParent(Node* root, Node* t, Node* parent = nullptr) {
-    if (!root) return nullptr;
-    if (root == t) return parent;
+// Depth and rank need a walk up the parent links (O(height)), so
+// they are cached per selection and only refreshed when the
+// selection or the tree (treeVersion) changes.
+struct SelectionInfo {
+    Node* node = nullptr;
+    int version = -1;
+    int depth = 0;
+    int rank = 0;      // 1-based in-order position
+};
+
+SelectionInfo selectionInfo;
 
-    Node* L = findParent(root->left, t, root);
-    if (L) return L;
+void refreshSelectionInfo(Node* n) {
+    SelectionInfo& info = selectionInfo;
+    if (info.node == n && info.version == treeVersion) return;
 
-    return findParent(root->right, t, root);
-}
+    info.node = n;
+    info.version = treeVersion;
+    info.depth = 0;
+    info.rank = sizeOf(n->left) + 1;
 
-int nodeHeight(Node* n) {
-    if (!n) return -1;
-    return 1 + max(nodeHeight(n->left), nodeHeight(n->right));
+    for (Node* c = n; c->parent; c = c->parent) {
+        info.depth++;
+        if (c == c->parent->right)
+            info.rank += sizeOf(c->parent->left) + 1;
+    }
 }
 
 bool isLeaf(Node* n) {
@@ -182,23 +568,15 @@ Color blend(Color a, Color b, float t) {
     };
 }
 
-void drawEdges(Node* n) {
-    if (!n) return;
-
-    if (n->left)  DrawLine(n->x, n->y, n->left->x, n->left->y, DARKGRAY);
-    if (n->right) DrawLine(n->x, n->y, n->right->x, n->right->y, DARKGRAY);
-
-    drawEdges(n->left);
-    drawEdges(n->right);
-}
-
-void drawNodes(Node* n) {
-    if (!n) return;
-
+Color nodeColor(Node* n) {
     Color base = Color{200,200,200,n->alpha};
     Color col = base;
     bool highlighted = false;
 
+    // Rotation glow (fades after an AVL rotation)
+    if (n->rotateGlow > 0)
+        col = blend(base, Color{170,90,230,255}, n->rotateGlow);
+
     // Selected node flashing
     if (n == selectedNode && !searchActive && !deleteAnimationActive) {
         float t = (sinf(globalTime * 6) + 1) / 2;
@@ -206,28 +584,324 @@ void drawNodes(Node* n) {
         highlighted = true;
     }
 
-    // Search animation
-    if (searchActive && !highlighted) {
-        for (int i = 0; i <= searchIndex; i++)
-            if (searchPath[i] == n)
-                col = blend(base, Color{255,150,0,255}, 0.6f);
+    // Search / query animation (hits turn green once reached)
+    if (searchActive && !highlighted && n->pathStamp == searchStamp && n->pathIndex <= searchIndex) {
+        col = blend(base, Color{255,150,0,255}, 0.6f);
+        if (n->hitStamp == searchStamp) col = Color{0,255,0,255};
 
-        if (searchIndex == searchPath.size()-1) {
-            if (searchFound && n == searchPath.back()) col = Color{0,255,0,255};
-            if (!searchFound && n == searchPath.back()) col = RED;
-        }
+        if (queryKind == QueryKind::Search && !searchFound &&
+            searchIndex == (int)searchPath.size()-1 && n == searchPath.back())
+            col = RED;
     }
 
     // Delete animation
     if (deleteAnimationActive && deleteTargetNode == n)
         col = RED;
 
-    DrawCircle(n->x, n->y, 24, col);
-    DrawCircleLines(n->x, n->y, 24, BLACK);
+    return col;
+}
+
+// ============================================================
+// BATCHED RENDERING
+// ============================================================
+// Drawing each node with DrawCircle + DrawCircleLines + DrawText
+// flips raylib between the shapes and font textures three times per
+// node, and every flip flushes a draw call.
+//
+// The batched path instead appends the frame's edges, discs,
+// outlines and key labels to four contiguous vertex arrays and
+// submits each array in one go, into a render batch big enough to
+// hold a whole frame. Labels are textured quads from a glyph atlas
+// (digits and '-' rasterized once at start-up), so they all share a
+// single texture. Disc segment count and labels scale with zoom.
+//
+// B toggles back to the immediate path for comparison.
+// ============================================================
+
+bool batchedRender = true;
+
+struct BatchVertex {
+    float x, y;
+    Color c;
+};
+
+struct GlyphVertex {
+    float x, y;
+    float u, v;
+};
+
+struct TreeBatch {
+    vector<BatchVertex> edges;      // RL_LINES
+    vector<BatchVertex> discs;      // RL_TRIANGLES
+    vector<BatchVertex> outlines;   // RL_LINES
+    vector<GlyphVertex> glyphs;     // RL_QUADS, atlas texture
+
+    int discSegments = 24;
+    bool labels = true;
+
+    // Unit circle at discSegments, rebuilt only when the LOD changes
+    vector<Vector2> rim;
+
+    rlRenderBatch gpuBatch;
+    bool gpuBatchLoaded = false;
+};
+
+TreeBatch treeBatch;
+
+const char* ATLAS_CHARS = "0123456789-";
+const int   ATLAS_FONT  = 20;
+
+struct GlyphAtlas {
+    RenderTexture2D target;
+    Rectangle glyph[11];   // source rect per ATLAS_CHARS entry
+    bool ready = false;
+};
+
+GlyphAtlas glyphAtlas;
+
+// Must run after InitWindow (needs a GL context)
+void buildGlyphAtlas() {
+    int w = 0;
+    for (int i = 0; ATLAS_CHARS[i]; i++) w += MeasureText(TextFormat("%c", ATLAS_CHARS[i]), ATLAS_FONT) + 2;
+
+    glyphAtlas.target = LoadRenderTexture(w, ATLAS_FONT);
+
+    BeginTextureMode(glyphAtlas.target);
+    ClearBackground(BLANK);
+    float x = 0;
+    for (int i = 0; ATLAS_CHARS[i]; i++) {
+        const char* ch = TextFormat("%c", ATLAS_CHARS[i]);
+        float gw = (float)MeasureText(ch, ATLAS_FONT);
+        DrawText(ch, (int)x, 0, ATLAS_FONT, WHITE);
+        glyphAtlas.glyph[i] = {x, 0, gw, (float)ATLAS_FONT};
+        x += gw + 2;
+    }
+    EndTextureMode();
+
+    glyphAtlas.ready = true;
+}
+
+void beginTreeBatch(float zoom) {
+    TreeBatch& b = treeBatch;
+    b.edges.clear();
+    b.discs.clear();
+    b.outlines.clear();
+    b.glyphs.clear();
+
+    // Level of detail from the on-screen radius
+    float px = NODE_RADIUS * zoom;
+    b.discSegments = (int)min(24.0f, max(6.0f, px / 1.5f));
+    b.labels = glyphAtlas.ready && ATLAS_FONT * zoom >= 6.0f;
+
+    if ((int)b.rim.size() != b.discSegments + 1) {
+        b.rim.resize(b.discSegments + 1);
+        float step = 2 * PI / b.discSegments;
+        for (int i = 0; i <= b.discSegments; i++) b.rim[i] = {cosf(i * step), sinf(i * step)};
+    }
+}
+
+void batchEdge(Node* a, Node* b) {
+    treeBatch.edges.push_back({a->x, a->y, DARKGRAY});
+    treeBatch.edges.push_back({b->x, b->y, DARKGRAY});
+}
+
+void batchNode(Node* n) {
+    TreeBatch& b = treeBatch;
+    Color col = nodeColor(n);
+
+    for (int i = 0; i < b.discSegments; i++) {
+        Vector2 p0 = {n->x + b.rim[i].x * NODE_RADIUS, n->y + b.rim[i].y * NODE_RADIUS};
+        Vector2 p1 = {n->x + b.rim[i + 1].x * NODE_RADIUS, n->y + b.rim[i + 1].y * NODE_RADIUS};
+
+        // Same winding as raylib's DrawCircleSector
+        b.discs.push_back({n->x, n->y, col});
+        b.discs.push_back({p1.x, p1.y, col});
+        b.discs.push_back({p0.x, p0.y, col});
+
+        b.outlines.push_back({p0.x, p0.y, BLACK});
+        b.outlines.push_back({p1.x, p1.y, BLACK});
+    }
+
+    if (!b.labels) return;
+
+    // Glyph indices straight from the key, most significant first
+    int digits[11];
+    int count = 0;
+    unsigned int mag = n->key < 0 ? 0u - (unsigned int)n->key : (unsigned int)n->key;
+    do {
+        digits[count++] = mag % 10;
+        mag /= 10;
+    } while (mag > 0);
+    if (n->key < 0) digits[count++] = 10;   // '-'
+
+    // Same anchor and spacing DrawText(TextFormat("%d"), x-10, y-10, 20) uses
+    float x = n->x - 10, y = n->y - 10;
+    float tw = (float)glyphAtlas.target.texture.width;
+    float th = (float)glyphAtlas.target.texture.height;
+
+    while (count > 0) {
+        Rectangle r = glyphAtlas.glyph[digits[--count]];
+
+        // Render textures are stored upside down → flip v
+        float u0 = r.x / tw, u1 = (r.x + r.width) / tw;
+        float v0 = 1.0f - r.y / th, v1 = 1.0f - (r.y + r.height) / th;
+
+        b.glyphs.push_back({x,           y,            u0, v0});
+        b.glyphs.push_back({x,           y + r.height, u0, v1});
+        b.glyphs.push_back({x + r.width, y + r.height, u1, v1});
+        b.glyphs.push_back({x + r.width, y,            u1, v0});
+
+        x += r.width + ATLAS_FONT / 10;
+    }
+}
+
+void submitVertices(int mode, const vector<BatchVertex>& v) {
+    const size_t CHUNK = 12 * 1024;   // whole lines / triangles / quads
+
+    for (size_t i = 0; i < v.size(); i += CHUNK) {
+        size_t end = min(v.size(), i + CHUNK);
+        rlCheckRenderBatchLimit((int)(end - i));
+
+        rlBegin(mode);
+        for (size_t k = i; k < end; k++) {
+            rlColor4ub(v[k].c.r, v[k].c.g, v[k].c.b, v[k].c.a);
+            rlVertex2f(v[k].x, v[k].y);
+        }
+        rlEnd();
+    }
+}
+
+void flushTreeBatch() {
+    TreeBatch& b = treeBatch;
+
+    if (!b.gpuBatchLoaded) {
+        b.gpuBatch = rlLoadRenderBatch(1, 1 << 16);
+        b.gpuBatchLoaded = true;
+    }
+
+    // Push out whatever raylib already queued, then draw into the big batch
+    rlDrawRenderBatchActive();
+    rlSetRenderBatchActive(&b.gpuBatch);
+
+    submitVertices(RL_LINES, b.edges);
+    submitVertices(RL_TRIANGLES, b.discs);
+    submitVertices(RL_LINES, b.outlines);
+
+    if (!b.glyphs.empty()) {
+        const size_t CHUNK = 4 * 1024;
+        rlSetTexture(glyphAtlas.target.texture.id);
+        for (size_t i = 0; i < b.glyphs.size(); i += CHUNK) {
+            size_t end = min(b.glyphs.size(), i + CHUNK);
+            rlCheckRenderBatchLimit((int)(end - i));
+
+            rlBegin(RL_QUADS);
+            rlColor4ub(0, 0, 0, 255);
+            for (size_t k = i; k < end; k++) {
+                rlTexCoord2f(b.glyphs[k].u, b.glyphs[k].v);
+                rlVertex2f(b.glyphs[k].x, b.glyphs[k].y);
+            }
+            rlEnd();
+        }
+        rlSetTexture(0);
+    }
+
+    rlSetRenderBatchActive(nullptr);   // draws the batch, restores raylib's
+}
+
+void drawEdge(Node* a, Node* b) {
+    if (batchedRender) batchEdge(a, b);
+    else DrawLine(a->x, a->y, b->x, b->y, DARKGRAY);
+}
+
+void drawNode(Node* n) {
+    if (batchedRender) {
+        batchNode(n);
+        return;
+    }
+
+    DrawCircle(n->x, n->y, NODE_RADIUS, nodeColor(n));
+    DrawCircleLines(n->x, n->y, NODE_RADIUS, BLACK);
     DrawText(TextFormat("%d", n->key), n->x - 10, n->y - 10, 20, BLACK);
+}
+
+// One pass per frame: animate, draw edges, draw node.
+// Children are animated before their edges are drawn so each line
+// ends where that child is drawn this frame; edges go down before
+// their parent's disc so the disc covers the line ends.
+void renderTree(Node* root) {
+    if (!root) return;
+
+    animateNode(root);
+
+    forEachPreorder(root, [](Node* n) {
+        if (n->left) {
+            animateNode(n->left);
+            drawEdge(n, n->left);
+        }
+        if (n->right) {
+            animateNode(n->right);
+            drawEdge(n, n->right);
+        }
+        drawNode(n);
+    });
+}
+
+// Culled path: only nodes whose disc or incoming edge touches the
+// camera view are animated and drawn. Falls back to renderTree only
+// until the first grid build after a bulk load.
+vector<Node*> visibleNodes;
 
-    drawNodes(n->left);
-    drawNodes(n->right);
+int renderVisible(Node* root, Rectangle view) {
+    if (!grid.valid) {
+        renderTree(root);
+        return sizeOf(root);
+    }
+
+    queryGrid(view, visibleNodes);
+
+    for (Node* n : visibleNodes) animateNode(n);
+
+    for (Node* n : visibleNodes)
+        if (n->parent)
+            drawEdge(n->parent, n);
+
+    for (Node* n : visibleNodes) drawNode(n);
+
+    return (int)visibleNodes.size();
+}
+
+
+// ============================================================
+// TREE RESET / DATASET LOAD
+// ============================================================
+
+// Swap in a new tree; nothing may keep pointing into the old nodes
+void replaceTree(Node* newRoot) {
+    root = newRoot;
+    computeLayout(root);
+    grid.valid = false;   // rebuilt in one go when the job finishes
+
+    selectedNode = nullptr;
+    deleteTargetNode = nullptr;
+    deleteAnimationActive = false;
+    searchActive = false;
+    searchPath.clear();
+}
+
+// Random distinct dataset, bulk-loaded and laid out in one pass.
+// Nodes start on their final slot and only fade in.
+void loadDataset(int count) {
+    vector<int> keys(count);
+    uniform_int_distribution<int> pick(1, max(99, count * 10));
+    for (int& k : keys) k = pick(keyRng);
+
+    replaceTree(bulkLoad(keys, true));
+    stepLayout(sizeOf(root) + 1);
+
+    forEachPreorder(root, [](Node* n) {
+        n->x = n->targetX;
+        n->y = n->targetY;
+    });
 }
 
 // ============================================================
@@ -272,14 +946,21 @@ bool DrawUIButton(UIButton &b) {
 // NODE PICKING (WORLD SPACE)
 // ============================================================
 
-void pickNode(Node* n, Vector2 m, float r, Node*& out) {
-    if (!n) return;
+void pickNode(Node* root, Vector2 m, float r, Node*& out) {
+    auto test = [&](Node* n) {
+        if ((m.x - n->x)*(m.x - n->x) + (m.y - n->y)*(m.y - n->y) <= r*r)
+            out = n;
+    };
 
-    if ((m.x - n->x)*(m.x - n->x) + (m.y - n->y)*(m.y - n->y) <= r*r)
-        out = n;
+    if (!grid.valid) {
+        forEachPreorder(root, test);
+        return;
+    }
 
-    pickNode(n->left, m, r, out);
-    pickNode(n->right, m, r, out);
+    // Only the cells around the cursor can hold a hit
+    vector<Node*> near;
+    queryGrid({m.x - r, m.y - r, 2 * r, 2 * r}, near);
+    for (Node* n : near) test(n);
 }
 
 // ============================================================
@@ -293,6 +974,10 @@ int main() {
 
     // Random seed for true randomness
     SetRandomSeed((unsigned int)time(NULL));
+    keyRng.seed((unsigned int)time(NULL));
+    onNodeDestroy = unfileNode;
+
+    buildGlyphAtlas();
 
     int inputValue = 0;
 
@@ -300,9 +985,26 @@ int main() {
     UIButton deleteBtn    = {{20,90,120,40},1,0.18f,Color{230,120,120,255},"Delete"};
     UIButton searchBtn    = {{20,140,120,40},1,0.18f,Color{120,160,230,255},"Search"};
     UIButton visualizeBtn = {{20,190,120,40},1,0.18f,Color{255,200,0,255},"Visualize"};
+    UIButton modeBtn      = {{20,290,120,40},1,0.18f,Color{190,150,240,255},"Mode: AVL"};
+    UIButton loadBtn      = {{20,340,120,40},1,0.18f,Color{120,220,220,255},"Load N"};
+    UIButton rankBtn      = {{20,390,120,40},1,0.18f,Color{240,180,120,255},"Rank"};
+    UIButton selectBtn    = {{20,440,120,40},1,0.18f,Color{240,180,120,255},"Select k"};
+    UIButton rangeBtn     = {{20,490,120,40},1,0.18f,Color{240,180,120,255},"Range"};
+    UIButton arrayBtn     = {{20,590,120,40},1,0.18f,Color{200,200,200,255},"Array: off"};
+    UIButton benchBtn     = {{20,640,120,40},1,0.18f,Color{200,200,200,255},"Bench"};
 
     Rectangle inputBox = {20,240,120,40};
 
+    // Upper bound for Range; Tab or a click moves typing focus
+    int hiValue = 0;
+    Rectangle hiBox = {20,540,120,40};
+    bool hiFocus = false;
+    vector<Node*> queryHits;
+
+    // Side-by-side pointer BST vs Eytzinger array lookups
+    bool arrayView = false;
+    bool arrayFound = false;
+
     while (!WindowShouldClose()) {
 
         float dt = GetFrameTime();
@@ -311,16 +1013,25 @@ int main() {
         // -------------------------------
         // CAMERA ZOOM
         // -------------------------------
-        if (IsKeyDown(KEY_I)) camZoomTarget += 0.02f;
-        if (IsKeyDown(KEY_O)) camZoomTarget -= 0.02f;
+        if (IsKeyPressed(KEY_B)) batchedRender = !batchedRender;
+
+        if (IsKeyDown(KEY_I)) camZoomTarget += 0.02f * camZoomTarget;
+        if (IsKeyDown(KEY_O)) camZoomTarget -= 0.02f * camZoomTarget;
 
-        camZoomTarget = (camZoomTarget < 0.3f) ? 0.3f : (camZoomTarget > 3.0f) ? 3.0f : camZoomTarget;
+        camZoomTarget = (camZoomTarget < 0.05f) ? 0.05f : (camZoomTarget > 3.0f) ? 3.0f : camZoomTarget;
         camZoom += (camZoomTarget - camZoom) * 0.1f;
 
+        // Right-drag pans (tidy layouts of big trees are wide)
+        if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) {
+            Vector2 d = GetMouseDelta();
+            camTarget.x -= d.x / camZoom;
+            camTarget.y -= d.y / camZoom;
+        }
+
         // Camera configuration
         Camera2D cam;
         cam.offset = {(float)GetScreenWidth()/2, (float)GetScreenHeight()/2};
-        cam.target = {700,200};
+        cam.target = camTarget;
         cam.rotation = 0;
         cam.zoom = camZoom;
 
@@ -336,21 +1047,33 @@ int main() {
         // INPUT BOX
         // -------------------------------
         DrawRectangleRec(inputBox, LIGHTGRAY);
-        DrawRectangleLines(inputBox.x,inputBox.y,inputBox.width,inputBox.height,BLACK);
+        DrawRectangleLines(inputBox.x,inputBox.y,inputBox.width,inputBox.height,hiFocus ? BLACK : BLUE);
         DrawText(TextFormat("%d", inputValue), inputBox.x+10,inputBox.y+8,20,BLACK);
 
+        DrawRectangleRec(hiBox, LIGHTGRAY);
+        DrawRectangleLines(hiBox.x,hiBox.y,hiBox.width,hiBox.height,hiFocus ? BLUE : BLACK);
+        DrawText(TextFormat("Hi: %d", hiValue), hiBox.x+10,hiBox.y+8,20,BLACK);
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            if (CheckCollisionPointRec(GetMousePosition(), inputBox)) hiFocus = false;
+            if (CheckCollisionPointRec(GetMousePosition(), hiBox)) hiFocus = true;
+        }
+
+        int& typed = hiFocus ? hiValue : inputValue;
         int key = GetKeyPressed();
+        if (key == KEY_TAB)
+            hiFocus = !hiFocus;
         if (key >= KEY_ZERO && key <= KEY_NINE)
-            inputValue = inputValue*10 + (key - KEY_ZERO);
+            typed = typed*10 + (key - KEY_ZERO);
         if (key == KEY_BACKSPACE && !selectedNode)
-            inputValue /= 10;
+            typed /= 10;
 
         // -------------------------------
         // UI BUTTONS
         // -------------------------------
         if (DrawUIButton(insertBtn)) {
-            root = insertRec(root, inputValue);
-            computeLayout(root,700,120,300);
+            root = insertKey(root, inputValue);
+            computeLayout(root);
         }
 
 if (DrawUIButton(deleteBtn)) {
@@ -360,34 +1083,93 @@ if (DrawUIButton(deleteBtn)) {
         deleteTimer = 0.6f;
     } else if (!selectedNode) {
         // Search for the node to delete it with animation
-        Node* toDelete = searchRecord(root, inputValue);
+        Node* toDelete = searchRecord(root, inputValue, searchPath);
         if (toDelete) {
             deleteTargetNode = toDelete;
             deleteAnimationActive = true;
             deleteTimer = 0.6f;
         } else {
             // Node doesn't exist, just try to remove anyway (no-op)
-            root = removeRec(root, inputValue);
-            computeLayout(root,700,120,300);
+            root = removeKey(root, inputValue);
+            computeLayout(root);
         }
     }
 }
 
         if (DrawUIButton(searchBtn)) {
-            Node* res = searchRecord(root, inputValue);
-            searchActive = true;
-            searchTimer = 0;
-            searchIndex = -1;
+            Node* res = searchRecord(root, inputValue, searchPath);
             searchFound = (res != nullptr);
+            beginPathAnimation(QueryKind::Search, res ? vector<Node*>{res} : vector<Node*>{});
+            snprintf(queryStatus, sizeof(queryStatus), "Search(%d): %s",
+                     inputValue, searchFound ? "found" : "not found");
+
+            if (arrayView) {
+                refreshEytzinger(root);
+                arrayFound = eytzingerProbe(inputValue, eytzProbes);
+            }
+        }
+
+        if (DrawUIButton(arrayBtn)) {
+            arrayView = !arrayView;
+            arrayBtn.label = arrayView ? "Array: on" : "Array: off";
+            eytzProbes.clear();
+        }
+
+        // 1M lookups on each structure (only meaningful on big trees: Load N first)
+        if (DrawUIButton(benchBtn)) {
+            runLookupBench(root, 1 << 20);
+            eytzProbes.clear();   // the array may have been rebuilt
+            arrayView = true;
+            arrayBtn.label = "Array: on";
+        }
+
+        // Order-statistic queries (input box = key / k / lo)
+        if (DrawUIButton(rankBtn)) {
+            int r = rankQuery(root, inputValue, searchPath);
+            beginPathAnimation(QueryKind::Rank, {});
+            snprintf(queryStatus, sizeof(queryStatus), "Rank(%d): %d keys smaller", inputValue, r);
+        }
+
+        if (DrawUIButton(selectBtn)) {
+            Node* kth = selectQuery(root, inputValue, searchPath);
+            beginPathAnimation(QueryKind::Select, kth ? vector<Node*>{kth} : vector<Node*>{});
+            if (kth)
+                snprintf(queryStatus, sizeof(queryStatus), "Select(%d): key %d", inputValue, kth->key);
+            else
+                snprintf(queryStatus, sizeof(queryStatus), "Select(%d): k out of range 1..%d",
+                         inputValue, sizeOf(root));
+        }
+
+        if (DrawUIButton(rangeBtn)) {
+            rangeQuery(root, inputValue, hiValue, searchPath, queryHits);
+            beginPathAnimation(QueryKind::Range, queryHits);
+            snprintf(queryStatus, sizeof(queryStatus), "Range[%d, %d]: %d keys, %d nodes visited",
+                     inputValue, hiValue, (int)queryHits.size(), (int)searchPath.size());
+        }
+
+        // Switch Plain ↔ AVL; entering AVL rebuilds the current tree
+        // balanced, since a Plain tree may already be degenerate
+        if (DrawUIButton(modeBtn) && !deleteAnimationActive) {
+            balanceMode = (balanceMode == BalanceMode::AVL) ? BalanceMode::Plain : BalanceMode::AVL;
+            modeBtn.label = (balanceMode == BalanceMode::AVL) ? "Mode: AVL" : "Mode: BST";
+
+            if (balanceMode == BalanceMode::AVL)
+                replaceTree(rebuildTree(root));
+        }
+
+        // Bulk-load N random keys (N = input value, 1000 if empty)
+        if (DrawUIButton(loadBtn)) {
+            visualizeActive = false;
+            loadDataset(inputValue > 0 ? min(inputValue, 10000000) : 1000);
         }
 
         // Visualize random BST
 if (DrawUIButton(visualizeBtn)) {
     // === 1. Reset everything for a fresh demonstration ===
-    // Delete old tree (if any)
-    while (root) {
-        root = removeRec(root, root->key);
-    }
+    // Drop the old tree in one go (no per-node removes)
+    nodePool.Reset();
+    treeVersion++;
+    replaceTree(nullptr);
 
     // Reset all visualization state
     visualizeActive = true;
@@ -412,8 +1194,8 @@ if (visualizeActive) {
     if (visualizeTimer >= 0.6f && visualizeIndex < (int)visualizeSeq.size()-1) {
         visualizeTimer = 0;
         visualizeIndex++;
-        root = insertRec(root, visualizeSeq[visualizeIndex]);
-        computeLayout(root,700,120,300);
+        root = insertKey(root, visualizeSeq[visualizeIndex]);
+        computeLayout(root);
         
         // Stop visualization when done
         if (visualizeIndex >= (int)visualizeSeq.size()-1) {
@@ -427,8 +1209,8 @@ if (visualizeActive) {
 // -------------------------------
 if (searchActive) {
     searchTimer += dt;
-    if (searchTimer >= 0.5f && searchIndex < (int)searchPath.size()-1) {
-        searchTimer = 0;
+    while (searchTimer >= searchStepTime && searchIndex < (int)searchPath.size()-1) {
+        searchTimer -= searchStepTime;
         searchIndex++;
     }
     
@@ -448,8 +1230,8 @@ if (searchActive) {
             deleteTimer -= dt;
             if (deleteTimer <= 0) {
                 int k = deleteTargetNode->key;
-                root = removeRec(root, k);
-                computeLayout(root,700,120,300);
+                root = removeKey(root, k);
+                computeLayout(root);
                 selectedNode = nullptr;
                 deleteTargetNode = nullptr;
                 deleteAnimationActive = false;
@@ -488,21 +1270,79 @@ if (searchActive) {
         // =====================================================
         // RENDER TREE USING CAMERA (Mode2D)
         // =====================================================
+        Vector2 viewMin = ScreenToWorld(cam, {0, 0});
+        Vector2 viewMax = ScreenToWorld(cam, {(float)GetScreenWidth(), (float)GetScreenHeight()});
+        Rectangle view = {viewMin.x, viewMin.y, viewMax.x - viewMin.x, viewMax.y - viewMin.y};
+
         BeginMode2D(cam);
 
-            updatePositions(root);
-            drawEdges(root);
-            drawNodes(root);
+            stepLayout(LAYOUT_BUDGET);
+            if (batchedRender) beginTreeBatch(camZoom);
+            int drawnCount = renderVisible(root, view);
+            if (batchedRender) flushTreeBatch();
 
         EndMode2D();
 
+        DrawText(TextFormat("Nodes: %d   drawn: %d   %s (B)   FPS: %d", sizeOf(root), drawnCount,
+                            batchedRender ? "batched" : "immediate", GetFPS()),
+                 20, GetScreenHeight() - 30, 18, DARKGRAY);
+
+        if (queryStatus[0])
+            DrawText(queryStatus, 20, GetScreenHeight() - 55, 20, DARKBLUE);
+
+        // =====================================================
+        // EYTZINGER ARRAY PANEL
+        // =====================================================
+        // Top: the whole array as one bar, each probe marked where it
+        // lands (early probes crowd the start = same cache lines).
+        // Bottom: probe order with slot and key, beside the length of
+        // the pointer path the tree search took.
+        if (arrayView) {
+            Rectangle panel = {200, (float)GetScreenHeight() - 200, 1180, 135};
+            DrawRectangleRec(panel, Fade(LIGHTGRAY, 0.9f));
+            DrawRectangleLines(panel.x, panel.y, panel.width, panel.height, BLACK);
+
+            DrawText(TextFormat("Eytzinger array: %d keys   probes: %d (%s)   pointer BST path: %d nodes",
+                                eytz.n, (int)eytzProbes.size(),
+                                eytzProbes.empty() ? "-" : (arrayFound ? "found" : "miss"),
+                                (int)searchPath.size()),
+                     panel.x + 10, panel.y + 8, 18, BLACK);
+
+            Rectangle bar = {panel.x + 10, panel.y + 34, panel.width - 20, 16};
+            DrawRectangleRec(bar, WHITE);
+            DrawRectangleLines(bar.x, bar.y, bar.width, bar.height, DARKGRAY);
+
+            int shown = min((int)eytzProbes.size(), 24);
+            for (int i = 0; i < shown; i++) {
+                int slot = eytzProbes[i];
+                float x = bar.x + bar.width * (float)(slot - 1) / max(1, eytz.n);
+                Color c = blend(Color{255,150,0,255}, Color{120,60,200,255}, (float)i / max(1, shown - 1));
+                DrawRectangle((int)x, bar.y - 2, 2, bar.height + 4, c);
+
+                Rectangle cell = {bar.x + i * 48.0f, bar.y + 26, 44, 34};
+                DrawRectangleRec(cell, c);
+                DrawText(TextFormat("%d", slot), cell.x + 3, cell.y + 2, 10, WHITE);
+                DrawText(TextFormat("%d", eytz.slots[slot]), cell.x + 3, cell.y + 16, 14, WHITE);
+            }
+
+            if (lookupBench.valid)
+                DrawText(TextFormat("Lookup over %d keys:  pointer BST %.1f ns   Eytzinger %.1f ns   (%.1fx)",
+                                    lookupBench.keys, lookupBench.treeNs, lookupBench.arrayNs,
+                                    lookupBench.treeNs / max(0.01, lookupBench.arrayNs)),
+                         panel.x + 10, panel.y + 108, 18, DARKBLUE);
+            else
+                DrawText("Bench: 1M random lookups (half misses) on both layouts",
+                         panel.x + 10, panel.y + 108, 18, DARKGRAY);
+        }
+
         // =====================================================
         // NODE INFO PANEL
         // =====================================================
         if (selectedNode) {
-            Node* p = findParent(root, selectedNode);
+            Node* p = selectedNode->parent;
+            refreshSelectionInfo(selectedNode);
 
-            Rectangle info = {1100, 40, 260, 160};
+            Rectangle info = {1100, 40, 260, 240};
             DrawRectangleRec(info, Color{230,230,230,255});
             DrawRectangleLines(info.x, info.y, info.width, info.height, BLACK);
 
@@ -514,16 +1354,27 @@ if (searchActive) {
                      info.x+10, info.y+80, 18, BLACK);
             DrawText(TextFormat("Parent: %s", p ? TextFormat("%d", p->key) : "null"),
                      info.x+10, info.y+100, 18, BLACK);
-            DrawText(TextFormat("Height: %d", nodeHeight(selectedNode)),
+            DrawText(TextFormat("Height: %d", selectedNode->height),
                      info.x+10, info.y+120, 18, BLACK);
-            DrawText(TextFormat("Leaf: %s", isLeaf(selectedNode) ? "yes" : "no"),
+            DrawText(TextFormat("Depth: %d", selectionInfo.depth),
                      info.x+10, info.y+140, 18, BLACK);
+            DrawText(TextFormat("Subtree size: %d", selectedNode->size),
+                     info.x+10, info.y+160, 18, BLACK);
+            DrawText(TextFormat("Rank: %d of %d", selectionInfo.rank, sizeOf(root)),
+                     info.x+10, info.y+180, 18, BLACK);
+            DrawText(TextFormat("Leaf: %s", isLeaf(selectedNode) ? "yes" : "no"),
+                     info.x+10, info.y+200, 18, BLACK);
+            DrawText(TextFormat("Balance: %d", balanceFactor(selectedNode)),
+                     info.x+10, info.y+220, 18, BLACK);
         }
 
         // END DRAW
         EndDrawing();
     }
 
+    UnloadRenderTexture(glyphAtlas.target);
+    if (treeBatch.gpuBatchLoaded) rlUnloadRenderBatch(treeBatch.gpuBatch);
+
     CloseWindow();
     return 0;
 }
@@ -2,6 +2,19 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include "NodePool.h"
 
 // ==========================================================
 // WINDOW SETTINGS
@@ -14,9 +27,22 @@ const float NODE_WIDTH   = 110.0f;
 const float NODE_HEIGHT  = 45.0f;
 const float NODE_SPACING = 150.0f;
 const float NODE_Y       = 260.0f;
+const float LIST_X       = 80.0f;    // x of the first node
 
-// DATA/NEXT proportion
+// Wrapped layouts: rows of NODES_PER_ROW, ROW_GAP apart
+const int   NODES_PER_ROW = 8;
+const float ROW_GAP       = 120.0f;
+
+// DATA/NEXT proportion (PREV cell takes its share first in doubly mode)
 const float DATA_PORTION = 0.6f;
+const float PREV_PORTION = 0.25f;
+
+// Unrolled list: a block holds up to BLOCK_CAPACITY values and is
+// drawn as one box, HEADER | value cells | NEXT
+const int   BLOCK_CAPACITY = 8;
+const float CELL_WIDTH     = 36.0f;
+const float BLOCK_HEADER_W = 18.0f;   // fill gauge, or PREV in doubly mode
+const float BLOCK_WIDTH    = BLOCK_HEADER_W + (BLOCK_CAPACITY + 1) * CELL_WIDTH;
 
 // ==========================================================
 // HELPER: LERP
@@ -31,6 +57,9 @@ float Lerp(float a, float b, float t) {
 struct Node {
     int value;
     Node* next;
+    Node* prev;      // only kept up to date in doubly linked mode
+
+    int slot;        // position in list order (LinkedList slot index)
 
     float x, y;
     float targetX, targetY;
@@ -38,16 +67,95 @@ struct Node {
     bool highlighted;
 
     Node(int v)
-        : value(v), next(nullptr),
+        : value(v), next(nullptr), prev(nullptr), slot(0),
           x(0), y(0), targetX(0), targetY(0),
           highlighted(false) {}
 };
 
 // ==========================================================
-// LINKED LIST
+// LIST OPERATIONS (command stream)
+// ==========================================================
+// Every edit can be written as a ListOp, so UI clicks, recorded
+// traces and generated workloads all go through ApplyOp.
+// Nodes are addressed by position (slot), which means the same
+// thing in every run, unlike a pointer.
+// ==========================================================
+enum class OpCode : uint8_t {
+    InsertHead, InsertTail, DeleteHead, DeleteTail, DeleteAt, MoveBefore, MoveAfter
+};
+
+struct ListOp {
+    OpCode code;
+    int a;   // value (inserts) or slot (DeleteAt / Move*)
+    int b;   // target slot (Move*)
+};
+
+// ==========================================================
+// LIST LAYOUT (shared by both list representations)
+// ==========================================================
+// Line       → one long row
+// Rows       → wrapped like text, each row left → right
+// Serpentine → every other row runs right → left, so the link
+//              between rows is a short drop at the same end
+//
+// Everything here depends only on slot numbers, never on how the
+// nodes are stored, so LinkedList and IndexedList both build on it.
+enum class LayoutMode { Line, Rows, Serpentine };
+
+// What DrawNodeBox needs to know about one node
+struct NodeBox {
+    float x, y;
+    int   value;
+    int   slot;
+    bool  isHead, hasNext, hasPrev;
+};
+
+class ListLayout {
+public:
+    Vector2 SlotPosition(int slot) const;
+    bool SlotRunsLeft(int slot) const;    // list order goes right → left here
+    void VisibleSlots(Rectangle view, int& first, int& last) const;
+
+    void SetLayout(LayoutMode mode) { layout = mode; }
+    LayoutMode GetLayout() const { return layout; }
+    int  Size() const { return count; }
+    int  SlotCount() const { return count; }
+    bool IsDoubly() const { return doubly; }
+
+protected:
+    ListLayout(float boxW = NODE_WIDTH, float step = NODE_SPACING, int rowSlots = NODES_PER_ROW)
+        : count(0), doubly(false), layout(LayoutMode::Line),
+          boxWidth(boxW), spacing(step), perRow(rowSlots) {}
+
+    int   count;   // slots: nodes, or blocks for UnrolledList
+    bool  doubly;  // prev links maintained → unlink/splice are O(1)
+    LayoutMode layout;
+
+    // Slot geometry: box width, distance between slots, slots per wrapped row
+    float boxWidth;
+    float spacing;
+    int   perRow;
+
+    bool RowRange(Rectangle view, float y, int& lo, int& hi) const;
+    int  LinkPath(int slot, Vector2 from, Vector2 to, float yOff, Vector2* pts) const;
+
+    static Color NodeFill(bool highlighted, bool selected, float pulse);
+    void DrawNodeBox(const NodeBox& b, Vector2 nextPos, Vector2 prevPos, Color fill) const;
+    void DrawHeadLabel(float centerX, float boxY) const;
+    void DrawLinks(int slot, Vector2 pos, bool hasNext, Vector2 nextPos, float nextY,
+                   bool hasPrev, Vector2 prevPos, float prevY) const;
+    void DrawDropIndicator(float x, float y, int slot, bool before) const;
+};
+
+// ==========================================================
+// LINKED LIST (pointer nodes)
 // ==========================================================
-class LinkedList {
+class LinkedList : public ListLayout {
 public:
+    typedef Node* Ref;                    // how the UI holds on to a node
+    static constexpr Node* NIL = nullptr;
+    static constexpr bool STABLE_REFS = true;   // a Ref survives other edits
+
     LinkedList();
     ~LinkedList();
 
@@ -56,23 +164,285 @@ public:
 
     void DeleteHead();
     void DeleteTail();
-    void DeleteByPointer(Node* node);
+    void DeleteNode(Node* node);
 
     void MoveNodeBefore(Node* node, Node* target);
     void MoveNodeAfter(Node* node, Node* target);
 
-    void UpdateLayout();
-    void UpdateAnimation(float dt, Node* dragging);
-    void Draw(Node* selected, float pulse,
+    // Mutators only mark the slot index dirty; EnsureLayout re-indexes
+    // once (from the earliest edit), so a burst of edits costs one pass.
+    // Only slots inside `view` (world space) are animated and drawn,
+    // so a frame costs the same for 10 nodes or 1M
+    void EnsureLayout();
+    void UpdateAnimation(float dt, Node* dragging, Rectangle view);
+    void Draw(Rectangle view, Node* selected, float pulse,
               Node* dropTarget, bool isDragging, bool dropBefore) const;
 
+    // O(log n) hit test / drop target among the visible slots
+    Node* PickNode(Rectangle view, Vector2 p) const;
+    Node* FindDropTarget(Rectangle view, Vector2 p, const Node* dragging, bool& before) const;
+
+    Node* NodeAt(int slot) const { return slots[slot]; }   // after EnsureLayout
+    Node* FindNode(int slot) const;                         // any time, no re-index
+
     Node* GetHead() const { return head; }
+    Node* GetTail() const { return tail; }
+
+    // Node access, same calls as IndexedList so the UI works on either
+    int     ValueOf(Node* node) const { return node->value; }
+    Node*   NextOf(Node* node) const { return node->next; }
+    Vector2 PositionOf(Node* node) const { return { node->x, node->y }; }
+    void    MoveTo(Node* node, Vector2 p) { node->x = p.x; node->y = p.y; }
+    void    SetHighlighted(Node* node, bool on) { node->highlighted = on; }
+
+    void Clear() { FreeList(); }
+    void ClearHighlights();
+
+    // For the storage benchmark: bytes owned (nodes, index, render
+    // state) and a sum over every value by following the links
+    size_t MemoryBytes() const;
+    long long SumValues() const;
+    int  SlotOf(Node* node) { EnsureLayout(); return node->slot; }
+
+    // Next UpdateAnimation places visible nodes directly (after a replay)
+    void SnapAnimation() { snapNextFrame = true; }
+
+    // Singly ↔ doubly linked; switching on rebuilds every prev link
+    void SetDoubly(bool on);
+    Node* PrevOf(Node* node) const;
 
 private:
     Node* head;
-    int   count;
+    Node* tail;    // last node, so appends don't walk the list
+
+    NodePool<Node> pool;   // all nodes live here; FreeList is one Reset
+
+    // slots[i] = i-th node in list order; its layout spot is SlotPosition(i)
+    std::vector<Node*> slots;
+    int dirtyFrom;   // first slot that may be stale, INT_MAX when clean
+    bool snapNextFrame;
+
+    void MarkDirty(int fromSlot) { dirtyFrom = std::min(dirtyFrom, fromSlot); }
+    void UpdateLayout(int fromSlot);
+    int  SlotAtX(int lo, int hi, float x) const;
 
     void FreeList();
+    void Unlink(Node* node, Node* prev);
+    void LinkAfter(Node* node, Node* prev);
+};
+
+// ==========================================================
+// INDEXED LIST (struct of arrays)
+// ==========================================================
+// The same list without heap nodes: parallel arrays, 32-bit links.
+//
+//   by node index   value[], next[], prev[]        (hot: traversal)
+//   by slot         visual[] = position, target, highlight   (cold)
+//
+// A node keeps its index for as long as it lives, so the index is
+// what the UI holds on to. Walking next[] touches 8 bytes per node
+// instead of a whole Node. visual[] is kept in list order (re-indexing
+// carries each node's entry along to its new slot), so animation,
+// drawing and picking read one contiguous run of it.
+// ==========================================================
+class IndexedList : public ListLayout {
+public:
+    typedef uint32_t Ref;
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr bool STABLE_REFS = true;
+
+    IndexedList();
+
+    void InsertHead(int value);
+    void InsertTail(int value);
+
+    void DeleteHead();
+    void DeleteTail();
+    void DeleteNode(uint32_t node);
+
+    void MoveNodeBefore(uint32_t node, uint32_t target);
+    void MoveNodeAfter(uint32_t node, uint32_t target);
+
+    void EnsureLayout();
+    void UpdateAnimation(float dt, uint32_t dragging, Rectangle view);
+    void Draw(Rectangle view, uint32_t selected, float pulse,
+              uint32_t dropTarget, bool isDragging, bool dropBefore) const;
+
+    uint32_t PickNode(Rectangle view, Vector2 p) const;
+    uint32_t FindDropTarget(Rectangle view, Vector2 p, uint32_t dragging, bool& before) const;
+
+    uint32_t NodeAt(int slot) const { return slots[slot]; }   // after EnsureLayout
+    uint32_t FindNode(int slot) const;                         // any time, no re-index
+
+    uint32_t GetHead() const { return head; }
+    uint32_t GetTail() const { return tail; }
+
+    // Per-slot state needs a clean index, so these re-index first
+    int      ValueOf(uint32_t node) const { return value[node]; }
+    uint32_t NextOf(uint32_t node) const { return next[node]; }
+    Vector2  PositionOf(uint32_t node) { EnsureLayout(); return { visual[slotOf[node]].x, visual[slotOf[node]].y }; }
+    void     MoveTo(uint32_t node, Vector2 p);
+    void     SetHighlighted(uint32_t node, bool on) { EnsureLayout(); visual[slotOf[node]].highlighted = on; }
+
+    void Clear();
+    void ClearHighlights();
+    size_t MemoryBytes() const;
+    long long SumValues() const;
+    int  SlotOf(uint32_t node) { EnsureLayout(); return (int)slotOf[node]; }
+    void SnapAnimation() { snapNextFrame = true; }
+
+    void SetDoubly(bool on);
+    uint32_t PrevOf(uint32_t node) const;
+
+private:
+    struct NodeVisual {
+        float x, y;
+        float targetX, targetY;
+        bool  highlighted;
+    };
+
+    uint32_t head;
+    uint32_t tail;
+
+    std::vector<int>      value;
+    std::vector<uint32_t> next;
+    std::vector<uint32_t> prev;      // only kept up to date in doubly linked mode
+    std::vector<uint32_t> freeIds;   // deleted node indices, reused first
+
+    std::vector<uint32_t>   slots;    // slot → node
+    std::vector<uint32_t>   slotOf;   // node → slot, NIL until first indexed
+    std::vector<NodeVisual> visual;   // by slot
+    std::vector<NodeVisual> scratch;  // UpdateLayout's copy of the old entries
+    int dirtyFrom;
+    bool snapNextFrame;
+
+    void MarkDirty(int fromSlot) { dirtyFrom = std::min(dirtyFrom, fromSlot); }
+    int  SlotHint(uint32_t node) const { return slotOf[node] == NIL ? count : (int)slotOf[node]; }
+    void UpdateLayout(int fromSlot);
+    int  SlotAtX(int lo, int hi, float x) const;
+    NodeVisual Spawn(int slot) const;
+
+    uint32_t Alloc(int v);
+    void Unlink(uint32_t node, uint32_t prevNode);
+    void LinkAfter(uint32_t node, uint32_t prevNode);
+};
+
+// ==========================================================
+// UNROLLED LIST (K values per block)
+// ==========================================================
+// Blocks of up to BLOCK_CAPACITY values, linked like nodes, so one
+// next pointer (and one cache miss) is paid per K values instead of
+// per value.
+//
+// Insert into a full block → split it in half
+// Delete leaves a block under half full → merge with the next block,
+//   or borrow its first value when both don't fit in one
+// The end blocks may run low: appends and head inserts start a new
+// block when the end one is full, and tail deletes never merge.
+//
+// Slots here are blocks: the layout places, animates and picks block
+// boxes. A value is addressed by its list position, found through
+// `first` (position of each block's first value) by binary search.
+// A position is not a stable handle: it shifts with edits before it.
+// ==========================================================
+struct Block {
+    int    count;
+    int    values[BLOCK_CAPACITY];
+    Block* next;
+    Block* prev;
+    int    slot;    // block index in list order, -1 until indexed
+    int    first;   // list position of values[0]
+};
+
+class UnrolledList : public ListLayout {
+public:
+    typedef int Ref;   // list position
+    static constexpr int NIL = -1;
+    static constexpr bool STABLE_REFS = false;
+
+    UnrolledList();
+    ~UnrolledList();
+
+    void InsertHead(int value);
+    void InsertTail(int value);
+    void InsertAt(int pos, int value);
+
+    void DeleteHead() { if (size > 0) DeleteNode(0); }
+    void DeleteTail();
+    void DeleteNode(int pos);
+
+    void MoveNodeBefore(int pos, int target) { MoveValue(pos, target, true); }
+    void MoveNodeAfter(int pos, int target) { MoveValue(pos, target, false); }
+
+    void EnsureLayout();
+    void UpdateAnimation(float dt, int dragging, Rectangle view);
+    void Draw(Rectangle view, int selected, float pulse,
+              int dropTarget, bool isDragging, bool dropBefore) const;
+
+    int PickNode(Rectangle view, Vector2 p) const;
+    int FindDropTarget(Rectangle view, Vector2 p, int dragging, bool& before) const;
+
+    int NodeAt(int pos) const { return pos; }
+    int FindNode(int pos) const { return pos; }
+    int GetHead() const { return size > 0 ? 0 : NIL; }
+    int GetTail() const { return size - 1; }
+    int Size() const { return size; }          // values; SlotCount() is blocks
+    int BlockCount() const { return count; }
+
+    int     ValueOf(int pos);
+    int     NextOf(int pos) const { return pos + 1 < size ? pos + 1 : NIL; }
+    int     PrevOf(int pos) const { return pos - 1; }
+    Vector2 PositionOf(int pos);
+    void    MoveTo(int, Vector2 p) { dragPos = p; }   // only one value is ever dragged
+    void    SetHighlighted(int pos, bool on);
+
+    void Clear();
+    void ClearHighlights() { highlighted = NIL; }
+    size_t MemoryBytes() const;
+    long long SumValues() const;
+    int  SlotOf(int pos) const { return pos; }
+    void SnapAnimation() { snapNextFrame = true; }
+
+    // Blocks always keep prev links; doubly only adds the PREV drawing
+    void SetDoubly(bool on) { doubly = on; }
+
+private:
+    struct BlockVisual {
+        float x, y;
+        float targetX, targetY;
+    };
+
+    Block* head;
+    Block* tail;
+    int    size;       // values
+
+    NodePool<Block> pool;
+
+    std::vector<Block*>      blocks;    // by slot
+    std::vector<BlockVisual> visual;    // by slot
+    std::vector<BlockVisual> scratch;
+    int dirtyFrom;
+    bool snapNextFrame;
+
+    int     highlighted;   // traversal cursor, NIL for none
+    Vector2 dragPos;       // where the dragged value is drawn
+
+    void MarkDirty(int fromSlot) { dirtyFrom = std::min(dirtyFrom, fromSlot); }
+    void UpdateLayout(int fromSlot);
+    int  SlotAtX(int lo, int hi, float x) const;
+    BlockVisual Spawn(int slot) const;
+
+    const Block* BlockOf(int pos) const;   // needs a clean index
+    Block* Locate(int pos, int& offset);
+    Block* NewBlockAfter(Block* prevBlock);
+    void   Unlink(Block* b);
+    void   Split(Block* b);
+    void   Rebalance(Block* b);
+    void   MoveValue(int pos, int target, bool before);
+
+    float CellX(int offset) const { return BLOCK_HEADER_W + offset * CELL_WIDTH; }
+    void  DrawBlock(int slot, Vector2 nextPos, Vector2 prevPos, int selected, float pulse,
+                    int dropTarget, bool dropBefore, int dragged) const;
 };
 
 // ==========================================================
@@ -137,275 +507,1636 @@ void DrawArrow(Vector2 start, Vector2 end, float thickness, Color color) {
     DrawTriangle(end, left, right, color);
 }
 
+// Polyline with an arrow head on its last segment
+void DrawArrowPath(const Vector2* pts, int n, float thickness, Color color) {
+    for (int i = 0; i + 2 < n; i++) DrawLineEx(pts[i], pts[i + 1], thickness, color);
+    DrawArrow(pts[n - 2], pts[n - 1], thickness, color);
+}
+
+// ==========================================================
+// LIST LAYOUT IMPLEMENTATION
+// ==========================================================
+Vector2 ListLayout::SlotPosition(int slot) const {
+    if (layout == LayoutMode::Line)
+        return { LIST_X + slot * spacing, NODE_Y };
+
+    int row = slot / perRow;
+    int col = slot % perRow;
+    if (SlotRunsLeft(slot)) col = perRow - 1 - col;
+    return { LIST_X + col * spacing, NODE_Y + row * ROW_GAP };
+}
+
+bool ListLayout::SlotRunsLeft(int slot) const {
+    return layout == LayoutMode::Serpentine && (slot / perRow) % 2 == 1;
+}
+
+// Link from the box at `from` (slot) to the next box at `to`,
+// as a polyline ending in the arrow point. Neighbours in one row
+// get a straight link; at a row break Rows goes down and back to
+// the left margin, Serpentine drops down at the same end.
+int ListLayout::LinkPath(int slot, Vector2 from, Vector2 to, float yOff, Vector2* pts) const {
+    bool left = SlotRunsLeft(slot);
+    bool rowBreak = layout != LayoutMode::Line && (slot + 1) % perRow == 0;
+
+    float sx = left ? from.x : from.x + boxWidth;
+    float sy = from.y + yOff;
+    float ey = to.y + yOff;
+    float lane = (yOff - NODE_HEIGHT / 2) * 0.5f;   // keeps next/prev routes apart
+
+    if (!rowBreak) {
+        pts[0] = { sx, sy };
+        pts[1] = { left ? to.x + boxWidth : to.x, ey };
+        return 2;
+    }
+
+    if (layout == LayoutMode::Serpentine) {
+        float side = left ? sx - 30 - lane : sx + 30 + lane;
+        pts[0] = { sx, sy };
+        pts[1] = { side, sy };
+        pts[2] = { side, ey };
+        pts[3] = { left ? to.x : to.x + boxWidth, ey };
+        return 4;
+    }
+
+    // Between the bottom of this row and the labels of the next
+    float midY = from.y + NODE_HEIGHT + (ROW_GAP - NODE_HEIGHT) * 0.3f + lane;
+    pts[0] = { sx, sy };
+    pts[1] = { sx + 20, sy };
+    pts[2] = { sx + 20, midY };
+    pts[3] = { to.x - 20, midY };
+    pts[4] = { to.x - 20, ey };
+    pts[5] = { to.x, ey };
+    return 6;
+}
+
+// Slot range whose boxes (plus labels/arrows) can touch the view;
+// first > last when nothing is visible
+void ListLayout::VisibleSlots(Rectangle view, int& first, int& last) const {
+    first = 0;
+    last = -1;
+    if (count == 0) return;
+
+    if (layout == LayoutMode::Line) {
+        if (view.y > NODE_Y + NODE_HEIGHT || view.y + view.height < NODE_Y - 80) return;
+
+        first = (int)std::max(0.0f, floorf((view.x - LIST_X - boxWidth - 80) / spacing));
+        last  = (int)std::min((float)count - 1, ceilf((view.x + view.width - LIST_X) / spacing));
+        return;
+    }
+
+    // Wrapped: whole rows (a row is about one screen wide)
+    float rowFirst = floorf((view.y - NODE_Y - NODE_HEIGHT) / ROW_GAP);
+    float rowLast  = ceilf((view.y + view.height - NODE_Y + 80) / ROW_GAP);
+    first = (int)std::max(0.0f, rowFirst * perRow);
+    last  = (int)std::min((float)count - 1, (rowLast + 1) * perRow - 1);
+}
+
+// ----------------------------------------------------------
+// Picking. Within one row the animated boxes stay in slot order
+// along x (mirrored in right → left rows), so the slot under a
+// point is a binary search instead of a scan. Only visible slots
+// are searched: off-screen nodes aren't animated, their x is stale.
+// ----------------------------------------------------------
+
+// Visible slots of the row nearest to world y
+bool ListLayout::RowRange(Rectangle view, float y, int& lo, int& hi) const {
+    int first, last;
+    VisibleSlots(view, first, last);
+    if (first > last) return false;
+
+    lo = first;
+    hi = last;
+    if (layout == LayoutMode::Line) return true;
+
+    int lastRow = (count - 1) / perRow;
+    int row = (int)floorf((y - NODE_Y - NODE_HEIGHT / 2) / ROW_GAP + 0.5f);
+    row = std::max(0, std::min(row, lastRow));
+
+    lo = std::max(first, row * perRow);
+    hi = std::min(last, row * perRow + perRow - 1);
+    return lo <= hi;
+}
+
+// One box with its labels and outgoing arrows; nextPos/prevPos are
+// the neighbours' boxes (their slot spot when they aren't animated)
+void ListLayout::DrawNodeBox(const NodeBox& b, Vector2 nextPos, Vector2 prevPos, Color fill) const {
+    // Doubly linked nodes get a PREV cell in front: PREV | DATA | NEXT
+    const float prevW = doubly ? NODE_WIDTH * PREV_PORTION : 0.0f;
+    const float dataW = (NODE_WIDTH - prevW) * DATA_PORTION;
+    const float nextW = NODE_WIDTH - prevW - dataW;
+    const float dataX = prevW;   // cell offsets inside the box
+    const float nextX = prevW + dataW;
+
+    // Two-way links: next arrows run above the middle, prev arrows below
+    const float nextArrowY = doubly ? NODE_HEIGHT * 0.35f : NODE_HEIGHT / 2;
+    const float prevArrowY = NODE_HEIGHT * 0.7f;
+
+    DrawRectangle((int)b.x, (int)b.y, (int)NODE_WIDTH, (int)NODE_HEIGHT, fill);
+    DrawRectangleLines((int)b.x, (int)b.y, (int)NODE_WIDTH, (int)NODE_HEIGHT, BLACK);
+    DrawLine((int)(b.x + nextX), (int)b.y, (int)(b.x + nextX), (int)(b.y + NODE_HEIGHT), BLACK);
+    if (doubly)
+        DrawLine((int)(b.x + dataX), (int)b.y, (int)(b.x + dataX), (int)(b.y + NODE_HEIGHT), BLACK);
+
+    int labelFont = doubly ? 11 : 14;
+    float labelY = b.y - 20.0f;
+    DrawText("DATA", (int)(b.x + dataX + dataW/2 - MeasureText("DATA", labelFont)/2), (int)labelY, labelFont, BLACK);
+    DrawText("NEXT", (int)(b.x + nextX + nextW/2 - MeasureText("NEXT", labelFont)/2), (int)labelY, labelFont, BLACK);
+    if (doubly)
+        DrawText("PREV", (int)(b.x + prevW/2 - MeasureText("PREV", labelFont)/2), (int)labelY, labelFont, BLACK);
+
+    if (b.isHead) DrawHeadLabel(b.x + dataX + dataW / 2.0f, b.y);
+
+    std::string valStr = std::to_string(b.value);
+    DrawText(valStr.c_str(), (int)(b.x + dataX + dataW/2 - MeasureText(valStr.c_str(), 18)/2),
+             (int)(b.y + NODE_HEIGHT/2 - 9), 18, BLACK);
+
+    std::string nextStr = b.hasNext ? "->" : "-";
+    DrawText(nextStr.c_str(), (int)(b.x + nextX + nextW/2 - MeasureText(nextStr.c_str(), 18)/2),
+             (int)(b.y + NODE_HEIGHT/2 - 9), 18, BLACK);
+
+    if (doubly) {
+        std::string prevStr = b.hasPrev ? "<-" : "-";
+        DrawText(prevStr.c_str(), (int)(b.x + prevW/2 - MeasureText(prevStr.c_str(), 18)/2),
+                 (int)(b.y + NODE_HEIGHT/2 - 9), 18, BLACK);
+    }
+
+    DrawLinks(b.slot, { b.x, b.y }, b.hasNext, nextPos, nextArrowY,
+              doubly && b.hasPrev, prevPos, prevArrowY);
+}
+
+void ListLayout::DrawHeadLabel(float centerX, float boxY) const {
+    float headY = boxY - 70.0f;
+    DrawText("HEAD", (int)(centerX - MeasureText("HEAD", 20)/2), (int)headY, 20, BLACK);
+    DrawArrow({centerX, headY + 24}, {centerX, boxY - 14}, 2.0f, BLACK);
+}
+
+// The box at `pos` (slot): its next link (or NULL), and the prev link
+// back to the box before it
+void ListLayout::DrawLinks(int slot, Vector2 pos, bool hasNext, Vector2 nextPos, float nextY,
+                           bool hasPrev, Vector2 prevPos, float prevY) const {
+    Vector2 pts[6];
+    bool left = SlotRunsLeft(slot);
+
+    if (hasNext) {
+        int n = LinkPath(slot, pos, nextPos, nextY, pts);
+        DrawArrowPath(pts, n, 3.0f, DARKGRAY);
+    } else {
+        Vector2 s = { left ? pos.x : pos.x + boxWidth, pos.y + nextY };
+        Vector2 e = { left ? s.x - 60 : s.x + 60, s.y };
+        DrawArrow(s, e, 3, DARKGRAY);
+        int nullX = left ? (int)e.x - 10 - MeasureText("NULL", 20) : (int)e.x + 10;
+        DrawText("NULL", nullX, (int)e.y - 10, 20, DARKGRAY);
+    }
+
+    // prev runs the same route as the link into this box, backwards
+    if (hasPrev) {
+        int n = LinkPath(slot - 1, prevPos, pos, prevY, pts);
+        std::reverse(pts, pts + n);
+        DrawArrowPath(pts, n, 2.0f, DARKBLUE);
+    }
+}
+
+Color ListLayout::NodeFill(bool highlighted, bool selected, float pulse) {
+    Color fill = LIGHTGRAY;
+    if (highlighted) fill = YELLOW;
+    if (selected) {
+        float r = Lerp((float)LIGHTGRAY.r, (float)RED.r, pulse);
+        float g = Lerp((float)LIGHTGRAY.g, (float)RED.g, pulse);
+        float b = Lerp((float)LIGHTGRAY.b, (float)RED.b, pulse);
+        fill = { (unsigned char)r, (unsigned char)g, (unsigned char)b, 255 };
+    }
+    return fill;
+}
+
+// Bar on the side the dragged node will land: green before, red after
+void ListLayout::DrawDropIndicator(float x, float y, int slot, bool before) const {
+    Color indColor = before ? GREEN : RED;
+    bool onLeft = before != SlotRunsLeft(slot);
+    float indX = onLeft ? x - 6 : x + boxWidth + 3;
+    DrawRectangle((int)indX, (int)y, 6, (int)NODE_HEIGHT, indColor);
+}
+
 // ==========================================================
 // LINKED LIST IMPLEMENTATION
 // ==========================================================
-LinkedList::LinkedList() : head(nullptr), count(0) {}
+LinkedList::LinkedList() : head(nullptr), tail(nullptr), dirtyFrom(INT_MAX), snapNextFrame(false) {}
 LinkedList::~LinkedList() { FreeList(); }
 
 void LinkedList::FreeList() {
-    Node* t = head;
-    while (t) {
-        Node* n = t->next;
-        delete t;
-        t = n;
-    }
-    head = nullptr;
+    pool.Reset();
+    slots.clear();
+    dirtyFrom = INT_MAX;
+    head = tail = nullptr;
     count = 0;
 }
 
+// ----------------------------------------------------------
+// Link primitives: every mutator goes through these two, so
+// head, tail and (in doubly mode) prev links stay consistent.
+// `prev` is node's predecessor, nullptr = node is / goes at head.
+// ----------------------------------------------------------
+void LinkedList::Unlink(Node* node, Node* prev) {
+    if (prev) prev->next = node->next;
+    else head = node->next;
+
+    if (node->next) {
+        if (doubly) node->next->prev = prev;
+    } else {
+        tail = prev;
+    }
+    node->next = nullptr;
+}
+
+void LinkedList::LinkAfter(Node* node, Node* prev) {
+    node->next = prev ? prev->next : head;
+    if (prev) prev->next = node;
+    else head = node;
+
+    if (doubly) {
+        node->prev = prev;
+        if (node->next) node->next->prev = node;
+    }
+    if (!node->next) tail = node;
+}
+
+// O(1) with prev links, otherwise a walk from head
+Node* LinkedList::PrevOf(Node* node) const {
+    if (doubly) return node->prev;
+
+    Node* prev = nullptr;
+    for (Node* t = head; t && t != node; t = t->next) prev = t;
+    return prev;
+}
+
+void LinkedList::SetDoubly(bool on) {
+    if (on && !doubly) {
+        Node* prev = nullptr;
+        for (Node* t = head; t; t = t->next) {
+            t->prev = prev;
+            prev = t;
+        }
+    }
+    doubly = on;
+}
+
+void LinkedList::ClearHighlights() {
+    for (Node* t = head; t; t = t->next) t->highlighted = false;
+}
+
+size_t LinkedList::MemoryBytes() const {
+    return pool.Capacity() * sizeof(Node) + slots.capacity() * sizeof(Node*);
+}
+
+long long LinkedList::SumValues() const {
+    long long sum = 0;
+    for (const Node* t = head; t; t = t->next) sum += t->value;
+    return sum;
+}
+
 void LinkedList::InsertHead(int value) {
-    Node* n = new Node(value);
-    n->next = head;
-    head = n;
+    Node* n = pool.Create(value);
+    LinkAfter(n, nullptr);
     count++;
-    UpdateLayout();
-    n->x = n->targetX - 150;
-    n->y = n->targetY;
+    MarkDirty(0);
+    Vector2 p = SlotPosition(0);
+    n->x = p.x - 150;
+    n->y = p.y;
 }
 
+// O(1): appending moves no other node, so only a new slot is added
 void LinkedList::InsertTail(int value) {
-    Node* n = new Node(value);
-    if (!head) {
-        head = n;
-        count++;
-        UpdateLayout();
-        n->x = n->targetX + 150;
-        n->y = n->targetY;
-        return;
-    }
-    Node* t = head;
-    while (t->next) t = t->next;
-    t->next = n;
+    Node* n = pool.Create(value);
+    LinkAfter(n, tail);
     count++;
-    UpdateLayout();
-    n->x = n->targetX + 150;
-    n->y = n->targetY;
+
+    n->slot = count - 1;
+    if (dirtyFrom == INT_MAX) slots.push_back(n);   // else the pending pass indexes it
+
+    Vector2 p = SlotPosition(n->slot);
+    n->x = p.x + 150;
+    n->y = p.y;
 }
 
 void LinkedList::DeleteHead() {
     if (!head) return;
     Node* old = head;
-    head = head->next;
-    delete old;
+    Unlink(old, nullptr);
+    pool.Destroy(old);
     count--;
-    UpdateLayout();
+    MarkDirty(0);
 }
 
+// Singly linked: one walk to find the new tail. Nothing else
+// moves, so no relayout either way.
 void LinkedList::DeleteTail() {
-    if (!head) return;
-    if (!head->next) {
-        delete head;
-        head = nullptr;
-        count = 0;
-        return;
-    }
-    Node* t = head;
-    while (t->next->next) t = t->next;
-    delete t->next;
-    t->next = nullptr;
+    if (!tail) return;
+    Node* old = tail;
+    Unlink(old, PrevOf(old));
+    pool.Destroy(old);
     count--;
-    UpdateLayout();
+    if (dirtyFrom == INT_MAX) slots.pop_back();
+    else MarkDirty(count);
 }
 
-void LinkedList::DeleteByPointer(Node* node) {
-    if (!node || !head) return;
-    if (node == head) { DeleteHead(); return; }
+// Slots before dirtyFrom are still indexed; past that, walk on from
+// the last indexed node, or back from the tail when doubly linked and
+// that is shorter. Lets a replay address nodes between edits without
+// a relayout per op.
+Node* LinkedList::FindNode(int slot) const {
+    if (slot < 0 || slot >= count) return nullptr;
+    if (slot < dirtyFrom) return slots[slot];
+
+    if (doubly && count - 1 - slot < slot - dirtyFrom) {
+        Node* t = tail;
+        for (int i = count - 1; i > slot; i--) t = t->prev;
+        return t;
+    }
+    Node* t = (dirtyFrom == 0) ? head : slots[dirtyFrom - 1]->next;
+    for (int i = dirtyFrom; i < slot; i++) t = t->next;
+    return t;
+}
 
-    Node* prev = head;
-    while (prev && prev->next != node) prev = prev->next;
-    if (!prev) return;
+void LinkedList::DeleteNode(Node* node) {
+    if (!node || !head) return;
 
-    prev->next = node->next;
-    delete node;
+    int from = node->slot;
+    Unlink(node, PrevOf(node));
+    pool.Destroy(node);
     count--;
-    UpdateLayout();
+    MarkDirty(from);
 }
 
 void LinkedList::MoveNodeBefore(Node* node, Node* target) {
     if (!node || !target || node == target || !head) return;
     if (node->next == target) return;
 
-    Node* prevNode = nullptr;
-    Node* prevTarget = nullptr;
-    Node* cur = head;
+    int from = std::min(node->slot, target->slot);
+    Unlink(node, PrevOf(node));
+    LinkAfter(node, PrevOf(target));
+
+    MarkDirty(from);
+}
+
+void LinkedList::MoveNodeAfter(Node* node, Node* target) {
+    if (!node || !target || node == target || !head) return;
+    if (target->next == node) return;
+
+    int from = std::min(node->slot, target->slot);
+    Unlink(node, PrevOf(node));
+    LinkAfter(node, target);
+
+    MarkDirty(from);
+}
+
+void LinkedList::EnsureLayout() {
+    if (dirtyFrom == INT_MAX) return;
+    UpdateLayout(dirtyFrom);
+    dirtyFrom = INT_MAX;
+}
+
+// Re-indexes slots from `fromSlot` on. Slots before it must be
+// untouched by the edit (their nodes and links are unchanged), so a
+// change near the tail only costs the nodes after it.
+void LinkedList::UpdateLayout(int fromSlot) {
+    slots.resize(count);
+    Node* t = (fromSlot == 0) ? head : slots[fromSlot - 1]->next;
+    for (int i = fromSlot; t; t = t->next) {
+        t->slot = i;
+        slots[i++] = t;
+    }
+}
+
+// First slot in [lo, hi] whose box centre is at or past x in list order
+int LinkedList::SlotAtX(int lo, int hi, float x) const {
+    bool left = SlotRunsLeft(lo);
+    auto before = [&](const Node* t) {
+        float cx = t->x + NODE_WIDTH / 2;
+        return left ? cx > x : cx < x;
+    };
+    return (int)(std::partition_point(slots.begin() + lo, slots.begin() + hi + 1, before) - slots.begin());
+}
+
+Node* LinkedList::PickNode(Rectangle view, Vector2 p) const {
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return nullptr;
+
+    // The box under p sits next to the split point; the window also
+    // covers boxes that are briefly out of order mid-animation
+    int k = SlotAtX(lo, hi, p.x);
+    for (int i = std::max(lo, k - 2); i <= std::min(hi, k + 1); i++) {
+        Node* t = slots[i];
+        if (CheckCollisionPointRec(p, {t->x, t->y, NODE_WIDTH, NODE_HEIGHT})) return t;
+    }
+    return nullptr;
+}
+
+Node* LinkedList::FindDropTarget(Rectangle view, Vector2 p, const Node* dragging, bool& before) const {
+    before = false;
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return nullptr;
+
+    int k = SlotAtX(lo, hi, p.x);
+    Node* best = nullptr;
+    float bestDist = 1e9;
+
+    for (int i = std::max(lo, k - 2); i <= std::min(hi, k + 2); i++) {
+        Node* t = slots[i];
+        if (t == dragging) continue;
+
+        float centerX = t->x + NODE_WIDTH / 2;
+        float dist = fabsf(p.x - centerX);
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = t;
+            // "before" is the side list order comes from
+            before = SlotRunsLeft(i) ? (p.x > centerX) : (p.x < centerX);
+        }
+    }
+    return best;
+}
+
+void LinkedList::UpdateAnimation(float dt, Node* dragging, Rectangle view) {
+    const float speed = 10.0f;
+    EnsureLayout();
+
+    // Nodes further than this outside the view are stale (scrolled
+    // past, or moved while off-screen) and snap instead of flying in
+    Rectangle near = { view.x - 2*NODE_SPACING, view.y - 2*NODE_SPACING,
+                       view.width + 4*NODE_SPACING, view.height + 4*NODE_SPACING };
+
+    int first, last;
+    VisibleSlots(view, first, last);
+
+    for (int i = first; i <= last; i++) {
+        Node* t = slots[i];
+        Vector2 p = SlotPosition(i);
+        t->targetX = p.x;
+        t->targetY = p.y;
+
+        if (t == dragging) continue;
+        if (snapNextFrame || !CheckCollisionPointRec({t->x, t->y}, near)) {
+            t->x = p.x;
+            t->y = p.y;
+            continue;
+        }
+        t->x = Lerp(t->x, t->targetX, speed * dt);
+        t->y = Lerp(t->y, t->targetY, speed * dt);
+    }
+    snapNextFrame = false;
+}
+
+void LinkedList::Draw(Rectangle view, Node* selected, float pulse,
+                      Node* dropTarget, bool isDragging, bool dropBefore) const {
+    int first, last;
+    VisibleSlots(view, first, last);
+
+    // Neighbours outside the visible range aren't animated, so
+    // arrows aim at their slot instead of a stale position
+    auto posOf = [&](int slot) -> Vector2 {
+        if (slot >= first && slot <= last) return { slots[slot]->x, slots[slot]->y };
+        return SlotPosition(slot);
+    };
+
+    // The dragged node is drawn last so it stays on top (and stays
+    // visible even when its slot has scrolled away)
+    const Node* dragged = isDragging ? selected : nullptr;
+
+    for (int i = first; i <= last + 1; i++) {
+        const Node* t;
+        if (i <= last) {
+            t = slots[i];
+            if (t == dragged) continue;
+        } else {
+            if (!dragged) break;
+            t = dragged;
+        }
+
+        NodeBox box = { t->x, t->y, t->value, t->slot, t == head, t->next != nullptr, t->prev != nullptr };
+        DrawNodeBox(box, posOf(t->slot + 1), posOf(t->slot - 1), NodeFill(t->highlighted, t == selected, pulse));
+
+        if (isDragging && dropTarget == t) DrawDropIndicator(t->x, t->y, t->slot, dropBefore);
+    }
+}
+
+// ==========================================================
+// INDEXED LIST IMPLEMENTATION
+// ==========================================================
+// Mirrors the LinkedList code above with indices for pointers and
+// NIL for nullptr; only the slot index and visual[] work differently.
+// ==========================================================
+IndexedList::IndexedList() : head(NIL), tail(NIL), dirtyFrom(INT_MAX), snapNextFrame(false) {}
+
+void IndexedList::Clear() {
+    value.clear();
+    next.clear();
+    prev.clear();
+    freeIds.clear();
+    slots.clear();
+    slotOf.clear();
+    visual.clear();
+    dirtyFrom = INT_MAX;
+    head = tail = NIL;
+    count = 0;
+}
+
+uint32_t IndexedList::Alloc(int v) {
+    if (!freeIds.empty()) {
+        uint32_t id = freeIds.back();
+        freeIds.pop_back();
+        value[id] = v;
+        next[id] = prev[id] = slotOf[id] = NIL;
+        return id;
+    }
+    value.push_back(v);
+    next.push_back(NIL);
+    prev.push_back(NIL);
+    slotOf.push_back(NIL);
+    return (uint32_t)value.size() - 1;
+}
+
+void IndexedList::Unlink(uint32_t node, uint32_t prevNode) {
+    if (prevNode != NIL) next[prevNode] = next[node];
+    else head = next[node];
+
+    if (next[node] != NIL) {
+        if (doubly) prev[next[node]] = prevNode;
+    } else {
+        tail = prevNode;
+    }
+    next[node] = NIL;
+}
+
+void IndexedList::LinkAfter(uint32_t node, uint32_t prevNode) {
+    next[node] = prevNode != NIL ? next[prevNode] : head;
+    if (prevNode != NIL) next[prevNode] = node;
+    else head = node;
+
+    if (doubly) {
+        prev[node] = prevNode;
+        if (next[node] != NIL) prev[next[node]] = node;
+    }
+    if (next[node] == NIL) tail = node;
+}
+
+uint32_t IndexedList::PrevOf(uint32_t node) const {
+    if (doubly) return prev[node];
+
+    uint32_t p = NIL;
+    for (uint32_t t = head; t != NIL && t != node; t = next[t]) p = t;
+    return p;
+}
+
+void IndexedList::SetDoubly(bool on) {
+    if (on && !doubly) {
+        uint32_t p = NIL;
+        for (uint32_t t = head; t != NIL; t = next[t]) {
+            prev[t] = p;
+            p = t;
+        }
+    }
+    doubly = on;
+}
+
+void IndexedList::ClearHighlights() {
+    for (NodeVisual& v : visual) v.highlighted = false;
+}
+
+size_t IndexedList::MemoryBytes() const {
+    return value.capacity() * sizeof(int)
+         + (next.capacity() + prev.capacity() + freeIds.capacity()) * sizeof(uint32_t)
+         + (slots.capacity() + slotOf.capacity()) * sizeof(uint32_t)
+         + (visual.capacity() + scratch.capacity()) * sizeof(NodeVisual);
+}
+
+long long IndexedList::SumValues() const {
+    long long sum = 0;
+    for (uint32_t t = head; t != NIL; t = next[t]) sum += value[t];
+    return sum;
+}
+
+void IndexedList::MoveTo(uint32_t node, Vector2 p) {
+    EnsureLayout();
+    visual[slotOf[node]].x = p.x;
+    visual[slotOf[node]].y = p.y;
+}
+
+// New nodes fly in from the left at the head, from the right elsewhere
+IndexedList::NodeVisual IndexedList::Spawn(int slot) const {
+    Vector2 p = SlotPosition(slot);
+    return { slot == 0 ? p.x - 150 : p.x + 150, p.y, p.x, p.y, false };
+}
+
+void IndexedList::InsertHead(int v) {
+    uint32_t n = Alloc(v);
+    LinkAfter(n, NIL);
+    count++;
+    MarkDirty(0);
+}
+
+void IndexedList::InsertTail(int v) {
+    uint32_t n = Alloc(v);
+    LinkAfter(n, tail);
+    count++;
 
-    while (cur) {
-        if (cur->next == node) prevNode = cur;
-        if (cur->next == target) prevTarget = cur;
-        cur = cur->next;
+    if (dirtyFrom == INT_MAX) {
+        slotOf[n] = count - 1;
+        slots.push_back(n);
+        visual.push_back(Spawn(count - 1));
     }
+}
+
+void IndexedList::DeleteHead() {
+    if (head == NIL) return;
+    uint32_t old = head;
+    Unlink(old, NIL);
+    freeIds.push_back(old);
+    count--;
+    MarkDirty(0);
+}
 
-    if (node == head) {
-        head = node->next;
-    } else if (prevNode) {
-        prevNode->next = node->next;
+void IndexedList::DeleteTail() {
+    if (tail == NIL) return;
+    uint32_t old = tail;
+    Unlink(old, PrevOf(old));
+    freeIds.push_back(old);
+    count--;
+    if (dirtyFrom == INT_MAX) {
+        slots.pop_back();
+        visual.pop_back();
     } else {
+        MarkDirty(count);
+    }
+}
+
+// As LinkedList::FindNode
+uint32_t IndexedList::FindNode(int slot) const {
+    if (slot < 0 || slot >= count) return NIL;
+    if (slot < dirtyFrom) return slots[slot];
+
+    if (doubly && count - 1 - slot < slot - dirtyFrom) {
+        uint32_t t = tail;
+        for (int i = count - 1; i > slot; i--) t = prev[t];
+        return t;
+    }
+    uint32_t t = (dirtyFrom == 0) ? head : next[slots[dirtyFrom - 1]];
+    for (int i = dirtyFrom; i < slot; i++) t = next[t];
+    return t;
+}
+
+void IndexedList::DeleteNode(uint32_t node) {
+    if (node == NIL || head == NIL) return;
+
+    int from = SlotHint(node);
+    Unlink(node, PrevOf(node));
+    freeIds.push_back(node);
+    count--;
+    MarkDirty(from);
+}
+
+void IndexedList::MoveNodeBefore(uint32_t node, uint32_t target) {
+    if (node == NIL || target == NIL || node == target || head == NIL) return;
+    if (next[node] == target) return;
+
+    int from = std::min(SlotHint(node), SlotHint(target));
+    Unlink(node, PrevOf(node));
+    LinkAfter(node, PrevOf(target));
+
+    MarkDirty(from);
+}
+
+void IndexedList::MoveNodeAfter(uint32_t node, uint32_t target) {
+    if (node == NIL || target == NIL || node == target || head == NIL) return;
+    if (next[target] == node) return;
+
+    int from = std::min(SlotHint(node), SlotHint(target));
+    Unlink(node, PrevOf(node));
+    LinkAfter(node, target);
+
+    MarkDirty(from);
+}
+
+void IndexedList::EnsureLayout() {
+    if (dirtyFrom == INT_MAX) return;
+    UpdateLayout(dirtyFrom);
+    dirtyFrom = INT_MAX;
+}
+
+// As LinkedList::UpdateLayout, plus: every node from `fromSlot` on
+// had its old slot there too, so its visual entry is gathered from
+// a copy of that tail of visual[]. Nodes never indexed get a fresh one.
+void IndexedList::UpdateLayout(int fromSlot) {
+    scratch.assign(visual.begin() + std::min((size_t)fromSlot, visual.size()), visual.end());
+    slots.resize(count);
+    visual.resize(count);
+
+    uint32_t t = (fromSlot == 0) ? head : next[slots[fromSlot - 1]];
+    for (int i = fromSlot; t != NIL; t = next[t], i++) {
+        uint32_t was = slotOf[t];
+        visual[i] = (was == NIL) ? Spawn(i) : scratch[was - fromSlot];
+        slots[i] = t;
+        slotOf[t] = i;
+    }
+}
+
+int IndexedList::SlotAtX(int lo, int hi, float x) const {
+    bool left = SlotRunsLeft(lo);
+    auto before = [&](const NodeVisual& v) {
+        float cx = v.x + NODE_WIDTH / 2;
+        return left ? cx > x : cx < x;
+    };
+    return (int)(std::partition_point(visual.begin() + lo, visual.begin() + hi + 1, before) - visual.begin());
+}
+
+uint32_t IndexedList::PickNode(Rectangle view, Vector2 p) const {
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return NIL;
+
+    int k = SlotAtX(lo, hi, p.x);
+    for (int i = std::max(lo, k - 2); i <= std::min(hi, k + 1); i++) {
+        const NodeVisual& v = visual[i];
+        if (CheckCollisionPointRec(p, {v.x, v.y, NODE_WIDTH, NODE_HEIGHT})) return slots[i];
+    }
+    return NIL;
+}
+
+uint32_t IndexedList::FindDropTarget(Rectangle view, Vector2 p, uint32_t dragging, bool& before) const {
+    before = false;
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return NIL;
+
+    int k = SlotAtX(lo, hi, p.x);
+    uint32_t best = NIL;
+    float bestDist = 1e9;
+
+    for (int i = std::max(lo, k - 2); i <= std::min(hi, k + 2); i++) {
+        if (slots[i] == dragging) continue;
+
+        float centerX = visual[i].x + NODE_WIDTH / 2;
+        float dist = fabsf(p.x - centerX);
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = slots[i];
+            before = SlotRunsLeft(i) ? (p.x > centerX) : (p.x < centerX);
+        }
+    }
+    return best;
+}
+
+void IndexedList::UpdateAnimation(float dt, uint32_t dragging, Rectangle view) {
+    const float speed = 10.0f;
+    EnsureLayout();
+
+    Rectangle near = { view.x - 2*NODE_SPACING, view.y - 2*NODE_SPACING,
+                       view.width + 4*NODE_SPACING, view.height + 4*NODE_SPACING };
+
+    int first, last;
+    VisibleSlots(view, first, last);
+    int dragSlot = dragging == NIL ? -1 : (int)slotOf[dragging];
+
+    for (int i = first; i <= last; i++) {
+        NodeVisual& v = visual[i];
+        Vector2 p = SlotPosition(i);
+        v.targetX = p.x;
+        v.targetY = p.y;
+
+        if (i == dragSlot) continue;
+        if (snapNextFrame || !CheckCollisionPointRec({v.x, v.y}, near)) {
+            v.x = p.x;
+            v.y = p.y;
+            continue;
+        }
+        v.x = Lerp(v.x, v.targetX, speed * dt);
+        v.y = Lerp(v.y, v.targetY, speed * dt);
+    }
+    snapNextFrame = false;
+}
+
+void IndexedList::Draw(Rectangle view, uint32_t selected, float pulse,
+                       uint32_t dropTarget, bool isDragging, bool dropBefore) const {
+    int first, last;
+    VisibleSlots(view, first, last);
+
+    auto posOf = [&](int slot) -> Vector2 {
+        if (slot >= first && slot <= last) return { visual[slot].x, visual[slot].y };
+        return SlotPosition(slot);
+    };
+
+    int dragSlot = (isDragging && selected != NIL) ? (int)slotOf[selected] : -1;
+
+    for (int i = first; i <= last + 1; i++) {
+        int s = i;
+        if (i > last) {
+            if (dragSlot < 0) break;
+            s = dragSlot;
+        } else if (i == dragSlot) {
+            continue;
+        }
+
+        uint32_t n = slots[s];
+        const NodeVisual& v = visual[s];
+        NodeBox box = { v.x, v.y, value[n], s, n == head, next[n] != NIL, prev[n] != NIL };
+        DrawNodeBox(box, posOf(s + 1), posOf(s - 1), NodeFill(v.highlighted, n == selected, pulse));
+
+        if (isDragging && dropTarget == n) DrawDropIndicator(v.x, v.y, s, dropBefore);
+    }
+}
+
+// ==========================================================
+// UNROLLED LIST IMPLEMENTATION
+// ==========================================================
+UnrolledList::UnrolledList()
+    : ListLayout(BLOCK_WIDTH, BLOCK_WIDTH + 60.0f, 3),
+      head(nullptr), tail(nullptr), size(0), dirtyFrom(INT_MAX), snapNextFrame(false),
+      highlighted(NIL), dragPos({0, 0}) {}
+UnrolledList::~UnrolledList() { Clear(); }
+
+void UnrolledList::Clear() {
+    pool.Reset();
+    blocks.clear();
+    visual.clear();
+    dirtyFrom = INT_MAX;
+    head = tail = nullptr;
+    count = 0;
+    size = 0;
+    highlighted = NIL;
+}
+
+size_t UnrolledList::MemoryBytes() const {
+    return pool.Capacity() * sizeof(Block) + blocks.capacity() * sizeof(Block*)
+         + (visual.capacity() + scratch.capacity()) * sizeof(BlockVisual);
+}
+
+// One link per block; the values inside it are a plain array scan
+long long UnrolledList::SumValues() const {
+    long long sum = 0;
+    for (const Block* b = head; b; b = b->next)
+        for (int j = 0; j < b->count; j++) sum += b->values[j];
+    return sum;
+}
+
+// ----------------------------------------------------------
+// Block primitives
+// ----------------------------------------------------------
+Block* UnrolledList::NewBlockAfter(Block* prevBlock) {
+    Block* b = pool.Create();
+    b->count = 0;
+    b->slot = -1;
+    b->first = prevBlock ? prevBlock->first + prevBlock->count : 0;
+    b->prev = prevBlock;
+    b->next = prevBlock ? prevBlock->next : head;
+
+    if (prevBlock) prevBlock->next = b;
+    else head = b;
+    if (b->next) b->next->prev = b;
+    else tail = b;
+
+    count++;
+    return b;
+}
+
+void UnrolledList::Unlink(Block* b) {
+    if (b->prev) b->prev->next = b->next;
+    else head = b->next;
+    if (b->next) b->next->prev = b->prev;
+    else tail = b->prev;
+
+    pool.Destroy(b);
+    count--;
+}
+
+// Upper half moves to a new block right after b
+void UnrolledList::Split(Block* b) {
+    const int keep = BLOCK_CAPACITY / 2;
+    Block* nb = NewBlockAfter(b);
+    nb->count = b->count - keep;
+    std::copy(b->values + keep, b->values + b->count, nb->values);
+    b->count = keep;
+}
+
+// After a delete: an empty block goes; one under half full takes
+// the next block's values (merge) or its first value (borrow)
+void UnrolledList::Rebalance(Block* b) {
+    if (b->count == 0) {
+        Unlink(b);
         return;
     }
+    Block* n = b->next;
+    if (b->count >= BLOCK_CAPACITY / 2 || !n) return;
 
-    node->next = target;
-    if (target == head) {
-        head = node;
-    } else if (prevTarget) {
-        prevTarget->next = node;
+    if (b->count + n->count <= BLOCK_CAPACITY) {
+        std::copy(n->values, n->values + n->count, b->values + b->count);
+        b->count += n->count;
+        Unlink(n);
+    } else {
+        b->values[b->count++] = n->values[0];
+        std::copy(n->values + 1, n->values + n->count, n->values);
+        n->count--;
     }
+}
 
-    UpdateLayout();
+// Block holding list position pos (0 <= pos < size)
+const Block* UnrolledList::BlockOf(int pos) const {
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), pos,
+                               [](int p, const Block* b) { return p < b->first; });
+    return *(it - 1);
 }
 
-void LinkedList::MoveNodeAfter(Node* node, Node* target) {
-    if (!node || !target || node == target || !head) return;
-    if (target->next == node) return;
+Block* UnrolledList::Locate(int pos, int& offset) {
+    EnsureLayout();
+    Block* b = blocks[BlockOf(pos)->slot];
+    offset = pos - b->first;
+    return b;
+}
+
+// ----------------------------------------------------------
+// Edits
+// ----------------------------------------------------------
+
+// Needs no index, so a run of head inserts relayouts once. A full
+// head gets a new block in front (as appends do at the tail), so
+// blocks built from the head end up full rather than half full.
+void UnrolledList::InsertHead(int value) {
+    if (!head) {
+        InsertTail(value);
+        return;
+    }
+    if (head->count == BLOCK_CAPACITY) NewBlockAfter(nullptr);
+    std::copy_backward(head->values, head->values + head->count, head->values + head->count + 1);
+    head->values[0] = value;
+    head->count++;
+    size++;
+    MarkDirty(0);
+}
 
-    Node* prevNode = nullptr;
-    Node* cur = head;
-    while (cur && cur->next != node) {
-        cur = cur->next;
+// O(1) unless the tail block is full, and then only a new block
+void UnrolledList::InsertTail(int value) {
+    if (!tail || tail->count == BLOCK_CAPACITY) {
+        Block* b = NewBlockAfter(tail);
+        if (dirtyFrom == INT_MAX) {
+            b->slot = count - 1;
+            b->first = size;
+            blocks.push_back(b);
+            visual.push_back(Spawn(b->slot));
+        }
     }
-    if (cur) prevNode = cur;
+    tail->values[tail->count++] = value;
+    size++;
+}
 
-    if (node == head) {
-        head = node->next;
-    } else if (prevNode) {
-        prevNode->next = node->next;
+void UnrolledList::InsertAt(int pos, int value) {
+    if (pos >= size) {
+        InsertTail(value);
+        return;
+    }
+    int off;
+    Block* b = Locate(std::max(0, pos), off);
+    MarkDirty(b->slot);
+
+    if (b->count == BLOCK_CAPACITY) {
+        Split(b);
+        if (off > b->count) {
+            off -= b->count;
+            b = b->next;
+        }
+    }
+    std::copy_backward(b->values + off, b->values + b->count, b->values + b->count + 1);
+    b->values[off] = value;
+    b->count++;
+    size++;
+}
+
+void UnrolledList::DeleteTail() {
+    if (!tail) return;
+    tail->count--;
+    size--;
+    if (tail->count > 0) return;
+
+    Unlink(tail);
+    if (dirtyFrom == INT_MAX) {
+        blocks.pop_back();
+        visual.pop_back();
     } else {
+        MarkDirty(count);
+    }
+}
+
+void UnrolledList::DeleteNode(int pos) {
+    if (pos < 0 || pos >= size) return;
+    if (pos == size - 1) {
+        DeleteTail();
         return;
     }
+    int off;
+    Block* b = Locate(pos, off);
+    MarkDirty(b->slot);
+
+    std::copy(b->values + off + 1, b->values + b->count, b->values + off);
+    b->count--;
+    size--;
+    Rebalance(b);
+}
+
+// Same resulting order as LinkedList::MoveNodeBefore/After
+void UnrolledList::MoveValue(int pos, int target, bool before) {
+    if (pos == target || pos < 0 || target < 0 || pos >= size || target >= size) return;
+
+    int value = ValueOf(pos);
+    DeleteNode(pos);
+    if (target > pos) target--;
+    InsertAt(before ? target : target + 1, value);
+}
+
+int UnrolledList::ValueOf(int pos) {
+    int off;
+    Block* b = Locate(pos, off);
+    return b->values[off];
+}
+
+void UnrolledList::SetHighlighted(int pos, bool on) {
+    if (on) highlighted = pos;
+    else if (highlighted == pos) highlighted = NIL;
+}
+
+Vector2 UnrolledList::PositionOf(int pos) {
+    int off;
+    Block* b = Locate(pos, off);
+    const BlockVisual& v = visual[b->slot];
+    return { v.x + CellX(off), v.y };
+}
+
+// ----------------------------------------------------------
+// Block index: as IndexedList, with blocks for nodes. `first` is
+// rebuilt on the same pass, so a value edit marks its own block.
+// ----------------------------------------------------------
+void UnrolledList::EnsureLayout() {
+    if (dirtyFrom == INT_MAX) return;
+    UpdateLayout(dirtyFrom);
+    dirtyFrom = INT_MAX;
+}
+
+UnrolledList::BlockVisual UnrolledList::Spawn(int slot) const {
+    Vector2 p = SlotPosition(slot);
+    return { slot == 0 ? p.x - 150 : p.x + 150, p.y, p.x, p.y };
+}
+
+void UnrolledList::UpdateLayout(int fromSlot) {
+    scratch.assign(visual.begin() + std::min((size_t)fromSlot, visual.size()), visual.end());
+    blocks.resize(count);
+    visual.resize(count);
+
+    Block* b = (fromSlot == 0) ? head : blocks[fromSlot - 1]->next;
+    int first = (fromSlot == 0) ? 0 : blocks[fromSlot - 1]->first + blocks[fromSlot - 1]->count;
+    for (int i = fromSlot; b; b = b->next, i++) {
+        visual[i] = (b->slot < 0) ? Spawn(i) : scratch[b->slot - fromSlot];
+        blocks[i] = b;
+        b->slot = i;
+        b->first = first;
+        first += b->count;
+    }
+}
 
-    node->next = target->next;
-    target->next = node;
+// ----------------------------------------------------------
+// Picking: the block box by binary search (as the other lists),
+// then the cell inside it by x
+// ----------------------------------------------------------
+int UnrolledList::SlotAtX(int lo, int hi, float x) const {
+    bool left = SlotRunsLeft(lo);
+    auto before = [&](const BlockVisual& v) {
+        float cx = v.x + boxWidth / 2;
+        return left ? cx > x : cx < x;
+    };
+    return (int)(std::partition_point(visual.begin() + lo, visual.begin() + hi + 1, before) - visual.begin());
+}
+
+int UnrolledList::PickNode(Rectangle view, Vector2 p) const {
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return NIL;
+
+    int k = SlotAtX(lo, hi, p.x);
+    for (int i = std::max(lo, k - 1); i <= std::min(hi, k + 1); i++) {
+        const BlockVisual& v = visual[i];
+        if (!CheckCollisionPointRec(p, {v.x, v.y, boxWidth, NODE_HEIGHT})) continue;
 
-    UpdateLayout();
+        int cell = (int)floorf((p.x - v.x - BLOCK_HEADER_W) / CELL_WIDTH);
+        return (cell >= 0 && cell < blocks[i]->count) ? blocks[i]->first + cell : NIL;
+    }
+    return NIL;
 }
 
-void LinkedList::UpdateLayout() {
-    float x = 80.0f;
-    Node* t = head;
-    while (t) {
-        t->targetX = x;
-        t->targetY = NODE_Y;
-        x += NODE_SPACING;
-        t = t->next;
+int UnrolledList::FindDropTarget(Rectangle view, Vector2 p, int dragging, bool& before) const {
+    before = false;
+    int lo, hi;
+    if (!RowRange(view, p.y, lo, hi)) return NIL;
+
+    int k = SlotAtX(lo, hi, p.x);
+    int best = NIL;
+    float bestDist = 1e9;
+
+    for (int i = std::max(lo, k - 1); i <= std::min(hi, k + 1); i++) {
+        const Block* b = blocks[i];
+        for (int j = 0; j < b->count; j++) {
+            if (b->first + j == dragging) continue;
+
+            // Cells run left → right inside every box
+            float centerX = visual[i].x + CellX(j) + CELL_WIDTH / 2;
+            float dist = fabsf(p.x - centerX);
+            if (dist < bestDist) {
+                bestDist = dist;
+                best = b->first + j;
+                before = p.x < centerX;
+            }
+        }
     }
+    return best;
 }
 
-void LinkedList::UpdateAnimation(float dt, Node* dragging) {
+// ----------------------------------------------------------
+// Animation and drawing: one box per block
+// ----------------------------------------------------------
+void UnrolledList::UpdateAnimation(float dt, int dragging, Rectangle view) {
     const float speed = 10.0f;
-    Node* t = head;
-    while (t) {
-        if (t != dragging) {
-            t->x = Lerp(t->x, t->targetX, speed * dt);
-            t->y = Lerp(t->y, t->targetY, speed * dt);
+    EnsureLayout();
+    (void)dragging;   // the dragged value floats on its own, its block stays
+
+    Rectangle near = { view.x - 2*spacing, view.y - 2*spacing,
+                       view.width + 4*spacing, view.height + 4*spacing };
+
+    int first, last;
+    VisibleSlots(view, first, last);
+
+    for (int i = first; i <= last; i++) {
+        BlockVisual& v = visual[i];
+        Vector2 p = SlotPosition(i);
+        v.targetX = p.x;
+        v.targetY = p.y;
+
+        if (snapNextFrame || !CheckCollisionPointRec({v.x, v.y}, near)) {
+            v.x = p.x;
+            v.y = p.y;
+            continue;
         }
-        t = t->next;
+        v.x = Lerp(v.x, v.targetX, speed * dt);
+        v.y = Lerp(v.y, v.targetY, speed * dt);
     }
+    snapNextFrame = false;
 }
 
-void LinkedList::Draw(Node* selected, float pulse,
-                      Node* dropTarget, bool isDragging, bool dropBefore) const {
-    Node* t = head;
-    const float dataW = NODE_WIDTH * DATA_PORTION;
-    const float nextW = NODE_WIDTH - dataW;
+void UnrolledList::DrawBlock(int slot, Vector2 nextPos, Vector2 prevPos, int selected, float pulse,
+                             int dropTarget, bool dropBefore, int dragged) const {
+    const Block* b = blocks[slot];
+    const BlockVisual& v = visual[slot];
+    const float nextX = CellX(BLOCK_CAPACITY);
+    const int   font = 16;
 
-    while (t) {
-        bool isSel = (t == selected);
-        Color fill = LIGHTGRAY;
-        if (t->highlighted) fill = YELLOW;
-        if (isSel) {
-            float r = Lerp((float)LIGHTGRAY.r, (float)RED.r, pulse);
-            float g = Lerp((float)LIGHTGRAY.g, (float)RED.g, pulse);
-            float b = Lerp((float)LIGHTGRAY.b, (float)RED.b, pulse);
-            fill = { (unsigned char)r, (unsigned char)g, (unsigned char)b, 255 };
+    DrawRectangle((int)v.x, (int)v.y, (int)boxWidth, (int)NODE_HEIGHT, LIGHTGRAY);
+
+    // Header: how full the block is, or the PREV cell
+    if (doubly) {
+        DrawText("<", (int)(v.x + BLOCK_HEADER_W/2 - MeasureText("<", font)/2),
+                 (int)(v.y + NODE_HEIGHT/2 - font/2), font, BLACK);
+    } else {
+        float h = NODE_HEIGHT * b->count / BLOCK_CAPACITY;
+        DrawRectangle((int)v.x, (int)(v.y + NODE_HEIGHT - h), (int)BLOCK_HEADER_W, (int)h, SKYBLUE);
+    }
+
+    for (int j = 0; j < BLOCK_CAPACITY; j++) {
+        float cx = v.x + CellX(j);
+        int pos = b->first + j;
+
+        if (j >= b->count) {
+            DrawRectangle((int)cx, (int)v.y, (int)CELL_WIDTH, (int)NODE_HEIGHT, Fade(GRAY, 0.35f));
+        } else if (pos != dragged) {
+            if (pos == selected || pos == highlighted)
+                DrawRectangle((int)cx, (int)v.y, (int)CELL_WIDTH, (int)NODE_HEIGHT,
+                              NodeFill(pos == highlighted, pos == selected, pulse));
+
+            std::string s = std::to_string(b->values[j]);
+            DrawText(s.c_str(), (int)(cx + CELL_WIDTH/2 - MeasureText(s.c_str(), font)/2),
+                     (int)(v.y + NODE_HEIGHT/2 - font/2), font, BLACK);
+        }
+        DrawLine((int)cx, (int)v.y, (int)cx, (int)(v.y + NODE_HEIGHT), DARKGRAY);
+
+        if (pos == dropTarget) {
+            float indX = dropBefore ? cx - 3 : cx + CELL_WIDTH - 3;
+            DrawRectangle((int)indX, (int)v.y, 6, (int)NODE_HEIGHT, dropBefore ? GREEN : RED);
         }
+    }
+
+    DrawLine((int)(v.x + nextX), (int)v.y, (int)(v.x + nextX), (int)(v.y + NODE_HEIGHT), BLACK);
+    DrawRectangleLines((int)v.x, (int)v.y, (int)boxWidth, (int)NODE_HEIGHT, BLACK);
+
+    const char* label = TextFormat("block %d  %d/%d", slot, b->count, BLOCK_CAPACITY);
+    DrawText(label, (int)v.x, (int)(v.y - 20), 14, DARKGRAY);
+    if (slot == 0) DrawHeadLabel(v.x + boxWidth / 2, v.y);
+
+    const float nextArrowY = doubly ? NODE_HEIGHT * 0.35f : NODE_HEIGHT / 2;
+    DrawLinks(slot, { v.x, v.y }, b->next != nullptr, nextPos, nextArrowY,
+              doubly && b->prev, prevPos, NODE_HEIGHT * 0.7f);
+}
+
+void UnrolledList::Draw(Rectangle view, int selected, float pulse,
+                        int dropTarget, bool isDragging, bool dropBefore) const {
+    int first, last;
+    VisibleSlots(view, first, last);
+
+    auto posOf = [&](int slot) -> Vector2 {
+        if (slot >= first && slot <= last) return { visual[slot].x, visual[slot].y };
+        return SlotPosition(slot);
+    };
+
+    int dragged = isDragging ? selected : NIL;
+    if (!isDragging) dropTarget = NIL;
+
+    for (int i = first; i <= last; i++)
+        DrawBlock(i, posOf(i + 1), posOf(i - 1), selected, pulse, dropTarget, dropBefore, dragged);
+
+    // The dragged value floats as its own cell, on top
+    if (dragged != NIL && dragged < size) {
+        const Block* b = BlockOf(dragged);
+        std::string s = std::to_string(b->values[dragged - b->first]);
+        DrawRectangle((int)dragPos.x, (int)dragPos.y, (int)CELL_WIDTH, (int)NODE_HEIGHT,
+                      NodeFill(false, true, pulse));
+        DrawRectangleLines((int)dragPos.x, (int)dragPos.y, (int)CELL_WIDTH, (int)NODE_HEIGHT, BLACK);
+        DrawText(s.c_str(), (int)(dragPos.x + CELL_WIDTH/2 - MeasureText(s.c_str(), 16)/2),
+                 (int)(dragPos.y + NODE_HEIGHT/2 - 8), 16, BLACK);
+    }
+}
 
-        DrawRectangle((int)t->x, (int)t->y, (int)NODE_WIDTH, (int)NODE_HEIGHT, fill);
-        DrawRectangleLines((int)t->x, (int)t->y, (int)NODE_WIDTH, (int)NODE_HEIGHT, BLACK);
-        DrawLine((int)(t->x + dataW), (int)t->y, (int)(t->x + dataW), (int)(t->y + NODE_HEIGHT), BLACK);
+// ==========================================================
+// COMMAND STREAM
+// ==========================================================
+// Out-of-range slots are skipped, so any trace replays safely.
+// Slots are resolved with FindNode, so a run of ops leaves the
+// relayout to whoever calls EnsureLayout next.
+// ==========================================================
+template <typename List>
+void ApplyOp(List& list, const ListOp& op) {
+    int n = list.Size();
+    switch (op.code) {
+    case OpCode::InsertHead: list.InsertHead(op.a); break;
+    case OpCode::InsertTail: list.InsertTail(op.a); break;
+    case OpCode::DeleteHead: list.DeleteHead(); break;
+    case OpCode::DeleteTail: list.DeleteTail(); break;
+
+    case OpCode::DeleteAt:
+        if (op.a < 0 || op.a >= n) break;
+        list.DeleteNode(list.FindNode(op.a));
+        break;
+
+    case OpCode::MoveBefore:
+    case OpCode::MoveAfter:
+        if (op.a < 0 || op.a >= n || op.b < 0 || op.b >= n) break;
+        if (op.code == OpCode::MoveBefore) list.MoveNodeBefore(list.FindNode(op.a), list.FindNode(op.b));
+        else list.MoveNodeAfter(list.FindNode(op.a), list.FindNode(op.b));
+        break;
+    }
+}
 
-        int labelFont = 14;
-        float labelY = t->y - 20.0f;
-        DrawText("DATA", (int)(t->x + dataW/2 - MeasureText("DATA", labelFont)/2), (int)labelY, labelFont, BLACK);
-        DrawText("NEXT", (int)(t->x + dataW + nextW/2 - MeasureText("NEXT", labelFont)/2), (int)labelY, labelFont, BLACK);
+// ==========================================================
+// TRACE FILES
+// ==========================================================
+// Text: one op per line, '#' starts a comment
+//     ih 5      insert head        dh     delete head
+//     it 7      insert tail        dt     delete tail
+//     del 3     delete slot 3
+//     mb 4 9    move slot 4 before slot 9   (ma = after)
+//
+// Binary: "LLTRACE1", uint32 count, then per op
+//     uint8 code, int32 a, int32 b   (little endian, 9 bytes)
+//
+// Loaders report problems through `error` instead of throwing.
+// ==========================================================
+const char* OP_NAMES[] = { "ih", "it", "dh", "dt", "del", "mb", "ma" };
+const int   OP_COUNT   = 7;
+const char  TRACE_MAGIC[8] = { 'L','L','T','R','A','C','E','1' };
+
+int OpArgCount(OpCode code) {
+    switch (code) {
+    case OpCode::InsertHead:
+    case OpCode::InsertTail:
+    case OpCode::DeleteAt:   return 1;
+    case OpCode::MoveBefore:
+    case OpCode::MoveAfter:  return 2;
+    default:                 return 0;
+    }
+}
+
+void PutInt32(std::ostream& out, int v) {
+    uint32_t u = (uint32_t)v;
+    char b[4] = { (char)(u & 0xFF), (char)((u >> 8) & 0xFF), (char)((u >> 16) & 0xFF), (char)(u >> 24) };
+    out.write(b, 4);
+}
+
+int GetInt32(const unsigned char* b) {
+    return (int)((uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24));
+}
 
-        if (t == head) {
-            float dataCenterX = t->x + dataW / 2.0f;
-            float headY = t->y - 70.0f;
-            DrawText("HEAD", (int)(dataCenterX - MeasureText("HEAD", 20)/2), (int)headY, 20, BLACK);
-            DrawArrow({dataCenterX, headY + 24}, {dataCenterX, t->y - 14}, 2.0f, BLACK);
+bool SaveTrace(const std::string& path, const std::vector<ListOp>& ops, bool binary) {
+    std::ofstream out(path, binary ? std::ios::binary : std::ios::out);
+    if (!out) return false;
+
+    if (binary) {
+        out.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+        PutInt32(out, (int)ops.size());
+        for (const ListOp& op : ops) {
+            out.put((char)op.code);
+            PutInt32(out, op.a);
+            PutInt32(out, op.b);
         }
+    } else {
+        out << "# linked list trace, " << ops.size() << " ops\n";
+        for (const ListOp& op : ops) {
+            out << OP_NAMES[(int)op.code];
+            int args = OpArgCount(op.code);
+            if (args >= 1) out << ' ' << op.a;
+            if (args >= 2) out << ' ' << op.b;
+            out << '\n';
+        }
+    }
+    return (bool)out;
+}
 
-        std::string valStr = std::to_string(t->value);
-        DrawText(valStr.c_str(), (int)(t->x + dataW/2 - MeasureText(valStr.c_str(), 18)/2),
-                 (int)(t->y + NODE_HEIGHT/2 - 9), 18, BLACK);
+bool LoadTrace(const std::string& path, std::vector<ListOp>& ops, std::string& error) {
+    ops.clear();
+    std::ifstream in(path, std::ios::binary);
+    if (!in) { error = "cannot open " + path; return false; }
+
+    char magic[sizeof(TRACE_MAGIC)] = {};
+    in.read(magic, sizeof(magic));
+
+    if (in && memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0) {
+        unsigned char head[4];
+        if (!in.read((char*)head, 4)) { error = "truncated header"; return false; }
+        int n = GetInt32(head);
+
+        // The count comes from the file: check it against what's
+        // actually there before sizing a buffer by it
+        std::streamoff start = in.tellg();
+        in.seekg(0, std::ios::end);
+        std::streamoff left = in.tellg() - start;
+        in.seekg(start);
+        if (n < 0 || (std::streamoff)n * 9 > left) {
+            error = "header says " + std::to_string((uint32_t)n) + " ops, file holds " +
+                    std::to_string(left / 9);
+            return false;
+        }
 
-        std::string nextStr = t->next ? "->" : "-";
-        DrawText(nextStr.c_str(), (int)(t->x + dataW + nextW/2 - MeasureText(nextStr.c_str(), 18)/2),
-                 (int)(t->y + NODE_HEIGHT/2 - 9), 18, BLACK);
+        std::vector<unsigned char> data((size_t)n * 9);
+        if (!in.read((char*)data.data(), data.size())) { error = "truncated op list"; return false; }
 
-        if (t->next) {
-            Vector2 s = { t->x + NODE_WIDTH, t->y + NODE_HEIGHT/2 };
-            Vector2 e = { t->next->x, t->next->y + NODE_HEIGHT/2 };
-            DrawArrow(s, e, 3.0f, DARKGRAY);
+        ops.reserve(n);
+        for (int i = 0; i < n; i++) {
+            const unsigned char* r = &data[(size_t)i * 9];
+            if (r[0] >= OP_COUNT) { error = "bad opcode in op " + std::to_string(i); return false; }
+            ops.push_back({ (OpCode)r[0], GetInt32(r + 1), GetInt32(r + 5) });
         }
+        return true;
+    }
 
-        if (isDragging && dropTarget == t) {
-            Color indColor = dropBefore ? GREEN : RED;
-            float indX = dropBefore ? t->x - 6 : t->x + NODE_WIDTH + 3;
-            DrawRectangle((int)indX, (int)t->y, 6, (int)NODE_HEIGHT, indColor);
+    // Text
+    in.clear();
+    in.seekg(0);
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream ls(line);
+        std::string name;
+        if (!(ls >> name)) continue;
+
+        int code = 0;
+        while (code < OP_COUNT && name != OP_NAMES[code]) code++;
+        if (code == OP_COUNT) {
+            error = "line " + std::to_string(lineNo) + ": unknown op '" + name + "'";
+            return false;
         }
 
-        t = t->next;
+        ListOp op = { (OpCode)code, 0, 0 };
+        int* dest[2] = { &op.a, &op.b };
+        for (int k = 0; k < OpArgCount(op.code); k++) {
+            std::string tok;
+            if (!(ls >> tok)) {
+                error = "line " + std::to_string(lineNo) + ": missing argument";
+                return false;
+            }
+            // The whole token must be an int: "3x" or 99999999999 is a corrupt trace
+            errno = 0;
+            char* end = nullptr;
+            long v = strtol(tok.c_str(), &end, 10);
+            if (*end != '\0' || errno == ERANGE || v < INT_MIN || v > INT_MAX) {
+                error = "line " + std::to_string(lineNo) + ": bad argument '" + tok + "'";
+                return false;
+            }
+            *dest[k] = (int)v;
+        }
+        ops.push_back(op);
     }
+    return true;
+}
 
-    if (head) {
-        Node* last = head;
-        while (last->next) last = last->next;
-        Vector2 s = { last->x + NODE_WIDTH, last->y + NODE_HEIGHT/2 };
-        Vector2 e = { last->x + NODE_WIDTH + 60, last->y + NODE_HEIGHT/2 };
-        DrawArrow(s, e, 3, DARKGRAY);
-        DrawText("NULL", (int)e.x + 10, (int)e.y - 10, 20, DARKGRAY);
+// Applies the whole trace to an empty list with no animation in
+// between; returns the wall time in seconds (final relayout included).
+// Runs doubly linked so unlinks don't walk for the predecessor, then
+// drops back to the list's own mode.
+template <typename List>
+double ReplayTrace(List& list, const std::vector<ListOp>& ops) {
+    auto start = std::chrono::steady_clock::now();
+
+    bool wasDoubly = list.IsDoubly();
+    list.Clear();
+    list.SetDoubly(true);
+    for (const ListOp& op : ops) ApplyOp(list, op);
+    list.SetDoubly(wasDoubly);
+    list.EnsureLayout();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Random workload: mostly appends, with head inserts, deletes and moves
+std::vector<ListOp> GenerateTrace(int n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<ListOp> ops;
+    ops.reserve(n);
+    int size = 0;
+
+    for (int i = 0; i < n; i++) {
+        int r = (int)(rng() % 100);
+        int value = (int)(rng() % 1000);
+
+        if (size < 2 || r < 40) {
+            ops.push_back({ OpCode::InsertTail, value, 0 });
+            size++;
+        } else if (r < 55) {
+            ops.push_back({ OpCode::InsertHead, value, 0 });
+            size++;
+        } else if (r < 62) {
+            ops.push_back({ OpCode::DeleteAt, (int)(rng() % size), 0 });
+            size--;
+        } else if (r < 67) {
+            ops.push_back({ r % 2 ? OpCode::DeleteHead : OpCode::DeleteTail, 0, 0 });
+            size--;
+        } else {
+            OpCode code = r % 2 ? OpCode::MoveBefore : OpCode::MoveAfter;
+            ops.push_back({ code, (int)(rng() % size), (int)(rng() % size) });
+        }
     }
+    return ops;
 }
 
 // ==========================================================
-// MAIN
+// STORAGE BENCHMARK
 // ==========================================================
-int main() {
-    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Linked List Visualiser - Drag & Drop + Dummy Node");
-    SetTargetFPS(60);
+// Builds the same n-value list in each representation by appending
+// and reports bytes per value (everything the list owns) and the
+// time per value of a full traversal (best of 5 passes). Then
+// replays one generated trace (up to REPLAY_BENCH_OPS mixed edits)
+// on each and reports ops per second.
+// ==========================================================
+const int REPLAY_BENCH_OPS = 100000;
+
+enum class Storage { Nodes, Indexed, Unrolled };
+const char* STORAGE_NAMES[] = { "Nodes", "SoA", "Unrolled" };
+
+template <typename List>
+void BenchStorage(const char* name, int n) {
+    List list;
+    for (int i = 0; i < n; i++) list.InsertTail(i);
+    list.EnsureLayout();
+
+    double best = 1e30;
+    long long sum = 0;
+    for (int pass = 0; pass < 5; pass++) {
+        auto start = std::chrono::steady_clock::now();
+        sum += list.SumValues();
+        best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    // sum keeps the walks from being optimised away
+    printf("%-9s %10.1f %12.2f   (sum %lld)\n", name, (double)list.MemoryBytes() / n, best / n, sum);
+}
+
+template <typename List>
+void BenchReplay(const char* name, const std::vector<ListOp>& ops) {
+    List list;
+    double seconds = ReplayTrace(list, ops);
+    printf("%-9s %10.2f %12.0f   (final size %d)\n", name, seconds * 1000.0,
+           seconds > 0 ? ops.size() / seconds : 0.0, list.Size());
+}
 
-    LinkedList list;
+void RunStorageBench(int n) {
+    printf("%d values, built by appending\n", n);
+    printf("%-9s %10s %12s\n", "storage", "B/value", "ns/value");
+    BenchStorage<LinkedList>(STORAGE_NAMES[0], n);
+    BenchStorage<IndexedList>(STORAGE_NAMES[1], n);
+    BenchStorage<UnrolledList>(STORAGE_NAMES[2], n);
+
+    std::vector<ListOp> ops = GenerateTrace(std::min(n, REPLAY_BENCH_OPS), 12345);
+    printf("\n%zu-op mixed trace, replayed\n", ops.size());
+    printf("%-9s %10s %12s\n", "storage", "ms", "ops/s");
+    BenchReplay<LinkedList>(STORAGE_NAMES[0], ops);
+    BenchReplay<IndexedList>(STORAGE_NAMES[1], ops);
+    BenchReplay<UnrolledList>(STORAGE_NAMES[2], ops);
+}
+
+// ==========================================================
+// VISUALIZER
+// ==========================================================
+// UI state that survives switching the list representation
+struct AppState {
+    Storage storage = Storage::Nodes;
+    Camera2D cam = { {0, 0}, {0, 0}, 0.0f, 1.0f };
+    std::string inputBuffer;
+    std::string status = "Enter a number and use buttons or drag nodes to reorder.";
+    bool recording = false;
+    std::vector<ListOp> trace;
+};
 
+const char* LayoutLabel(LayoutMode mode) {
+    return mode == LayoutMode::Line ? "Layout: Line"
+         : mode == LayoutMode::Rows ? "Layout: Rows" : "Layout: Snake";
+}
+
+// Rebuilds `to` with the values, layout and link mode of `from`
+template <typename From, typename To>
+void CopyList(From& from, To& to) {
+    to.Clear();
+    to.SetLayout(from.GetLayout());
+    to.SetDoubly(from.IsDoubly());
+    for (typename From::Ref t = from.GetHead(); t != From::NIL; t = from.NextOf(t))
+        to.InsertTail(from.ValueOf(t));
+    to.SnapAnimation();
+}
+
+// Runs the window on `list` until it closes (false) or the Storage
+// button asks for the other representation (true). Node handles are
+// List::Ref: a Node* for LinkedList, an index for IndexedList.
+template <typename List>
+bool RunVisualizer(List& list, AppState& app) {
     UIButton btnInsertHead = { {50, 500, 150, 40}, "Insert Head", GREEN };
     UIButton btnInsertTail = { {220, 500, 150, 40}, "Insert Tail", BLUE };
     UIButton btnDeleteHead = { {390, 500, 150, 40}, "Delete Head", RED };
     UIButton btnDeleteTail = { {560, 500, 150, 40}, "Delete Tail", ORANGE };
     UIButton btnTraverse   = { {730, 500, 150, 40}, "Traverse", PURPLE };
     UIButton btnAddDummy   = { {900, 500, 150, 40}, "Add Dummy", MAROON };  // NEW BUTTON
+    UIButton btnMode       = { {1070, 500, 160, 40}, list.IsDoubly() ? "Mode: Doubly" : "Mode: Singly", SKYBLUE };
+    UIButton btnLayout     = { {50, 550, 150, 40}, LayoutLabel(list.GetLayout()), BEIGE };
+    UIButton btnRecord     = { {220, 550, 150, 40}, app.recording ? "Stop" : "Record", DARKGREEN };
+    UIButton btnSave       = { {390, 550, 150, 40}, "Save Trace", DARKBLUE };
+    UIButton btnStorage    = { {560, 550, 170, 40}, std::string("Storage: ") + STORAGE_NAMES[(int)app.storage], LIGHTGRAY };
+
+    // Wrapped layouts can run under the controls; clicks there stay UI clicks
+    const UIButton* buttons[] = { &btnInsertHead, &btnInsertTail, &btnDeleteHead, &btnDeleteTail,
+                                  &btnTraverse, &btnAddDummy, &btnMode, &btnLayout,
+                                  &btnRecord, &btnSave, &btnStorage };
+    const Rectangle inputRect = { 50, 350, 200, 40 };
+    auto OverUI = [&](Vector2 p) {
+        if (CheckCollisionPointRec(p, inputRect)) return true;
+        for (const UIButton* b : buttons)
+            if (CheckCollisionPointRec(p, b->rect)) return true;
+        return false;
+    };
 
-    std::string inputBuffer;
-    std::string status = "Enter a number and use buttons or drag nodes to reorder.";
+    std::string& inputBuffer = app.inputBuffer;
+    std::string& status = app.status;
+
+    typedef typename List::Ref Ref;
+    const Ref NIL = List::NIL;
 
-    Node* selectedNode = nullptr;
+    Ref selectedNode = NIL;
     float flashTime = 0.0f;
 
-    Node* draggingNode = nullptr;
+    Ref draggingNode = NIL;
     bool isDragging = false;
     float dragOffsetX = 0, dragOffsetY = 0;
-    Node* dropTarget = nullptr;
+    Ref dropTarget = NIL;
     bool dropBefore = false;
 
     bool traversing = false;
-    Node* travNode = nullptr;
+    Ref travNode = NIL;
     float travTimer = 0.0f;
 
+    // World camera for the list; wheel zooms at the mouse, right-drag
+    // or arrow keys pan, Home/End jump to either end
+    Camera2D& cam = app.cam;
+
     auto ClearTraversal = [&]() {
         traversing = false;
-        travNode = nullptr;
+        travNode = NIL;
         travTimer = 0.0f;
-        Node* t = list.GetHead();
-        while (t) { t->highlighted = false; t = t->next; }
+        list.ClearHighlights();
+    };
+
+    // Every edit goes through Run, so a recording sees exactly what the list saw
+    bool& recording = app.recording;
+    std::vector<ListOp>& trace = app.trace;
+    auto Run = [&](ListOp op) {
+        ApplyOp(list, op);
+        if (recording) trace.push_back(op);
+        // A position handle would now name whichever value moved into it
+        if (!List::STABLE_REFS) selectedNode = NIL;
     };
 
     while (!WindowShouldClose()) {
@@ -421,135 +2152,230 @@ int main() {
         }
         if (IsKeyPressed(KEY_BACKSPACE)) {
             if (!inputBuffer.empty()) inputBuffer.pop_back();
-            else if (selectedNode && !isDragging) {
+            else if (selectedNode != NIL && !isDragging) {
                 ClearTraversal();
-                list.DeleteByPointer(selectedNode);
-                selectedNode = nullptr;
+                Run({ OpCode::DeleteAt, list.SlotOf(selectedNode), 0 });
+                selectedNode = NIL;
                 status = "Deleted selected node.";
             }
         }
 
-        // Mouse down: start drag or select
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            Vector2 mouse = GetMousePosition();
-            Node* clicked = nullptr;
-            Node* t = list.GetHead();
-            while (t) {
-                if (CheckCollisionPointRec(mouse, {t->x, t->y, NODE_WIDTH, NODE_HEIGHT})) {
-                    clicked = t;
-                    break;
+        // F: append 100k dummy nodes (stress test for the virtualized view)
+        if (IsKeyPressed(KEY_F) && inputBuffer.empty()) {
+            ClearTraversal();
+            for (int i = 0; i < 100000; i++) Run({ OpCode::InsertTail, i, 0 });
+            status = "Appended 100000 nodes.";
+        }
+
+        // Dropped trace file: replay it at full speed, then show the result
+        if (IsFileDropped()) {
+            FilePathList files = LoadDroppedFiles();
+            if (files.count > 0) {
+                std::vector<ListOp> ops;
+                std::string error;
+                if (LoadTrace(files.paths[0], ops, error)) {
+                    ClearTraversal();
+                    selectedNode = NIL;
+                    draggingNode = NIL;
+                    isDragging = false;
+                    recording = false;
+                    btnRecord.label = "Record";
+
+                    double seconds = ReplayTrace(list, ops);
+                    list.SnapAnimation();
+                    status = TextFormat("Replayed %d ops in %.1f ms (%.0f ops/s).", (int)ops.size(),
+                                        seconds * 1000.0, seconds > 0 ? ops.size() / seconds : 0.0);
+                } else {
+                    status = "Trace not loaded: " + error;
                 }
-                t = t->next;
             }
+            UnloadDroppedFiles(files);
+        }
+
+        // Camera
+        float wheel = GetMouseWheelMove();
+        if (wheel != 0) {
+            Vector2 mouse = GetMousePosition();
+            Vector2 anchor = GetScreenToWorld2D(mouse, cam);
+            cam.zoom = std::min(3.0f, std::max(0.1f, cam.zoom * (1.0f + 0.1f * wheel)));
+            cam.offset = mouse;
+            cam.target = anchor;
+        }
+        if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) {
+            Vector2 d = GetMouseDelta();
+            cam.target.x -= d.x / cam.zoom;
+            cam.target.y -= d.y / cam.zoom;
+        }
+        if (IsKeyDown(KEY_RIGHT)) cam.target.x += 900.0f * dt / cam.zoom;
+        if (IsKeyDown(KEY_LEFT))  cam.target.x -= 900.0f * dt / cam.zoom;
+        if (IsKeyPressed(KEY_HOME)) {
+            cam.offset = {0, 0};
+            cam.target = {0, 0};
+        }
+        if (IsKeyPressed(KEY_END) && list.SlotCount() > 0) {
+            Vector2 p = list.SlotPosition(list.SlotCount() - 1);
+            cam.offset = {0, 0};
+            if (list.GetLayout() == LayoutMode::Line)
+                cam.target = { p.x - SCREEN_WIDTH * 0.7f / cam.zoom, 0 };
+            else
+                cam.target = { 0, p.y - NODE_Y };
+        }
 
-            if (clicked) {
+        Vector2 viewMin = GetScreenToWorld2D({0, 0}, cam);
+        Vector2 viewMax = GetScreenToWorld2D({(float)SCREEN_WIDTH, (float)SCREEN_HEIGHT}, cam);
+        Rectangle view = { viewMin.x, viewMin.y, viewMax.x - viewMin.x, viewMax.y - viewMin.y };
+
+        // Picking below reads the slot index (edits so far this frame land here;
+        // button edits further down coalesce into UpdateAnimation's pass)
+        list.EnsureLayout();
+
+        // Mouse down: start drag or select (only on-screen slots can be hit)
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !OverUI(GetMousePosition())) {
+            Vector2 mouse = GetScreenToWorld2D(GetMousePosition(), cam);
+            Ref clicked = list.PickNode(view, mouse);
+
+            if (clicked != NIL) {
+                Vector2 pos = list.PositionOf(clicked);
                 selectedNode = clicked;
                 draggingNode = clicked;
                 isDragging = true;
-                dragOffsetX = mouse.x - clicked->x;
-                dragOffsetY = mouse.y - clicked->y;
+                dragOffsetX = mouse.x - pos.x;
+                dragOffsetY = mouse.y - pos.y;
                 flashTime = 0.0f;
             }
         }
 
         // Drag update
-        dropTarget = nullptr;
+        dropTarget = NIL;
         dropBefore = false;
 
-        if (isDragging && draggingNode && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
-            Vector2 mouse = GetMousePosition();
-            draggingNode->x = mouse.x - dragOffsetX;
-            draggingNode->y = mouse.y - dragOffsetY;
-
-            float mouseX = mouse.x;
-            Node* bestTarget = nullptr;
-            bool bestIsBefore = true;
-            float bestDist = 1e9;
-
-            Node* t = list.GetHead();
-            while (t) {
-                if (t == draggingNode) { t = t->next; continue; }
-
-                float centerX = t->x + NODE_WIDTH / 2;
-                float dist = fabsf(mouseX - centerX);
+        if (isDragging && draggingNode != NIL && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
+            Vector2 mouse = GetScreenToWorld2D(GetMousePosition(), cam);
+            list.MoveTo(draggingNode, { mouse.x - dragOffsetX, mouse.y - dragOffsetY });
 
-                if (dist < bestDist) {
-                    bestDist = dist;
-                    bestTarget = t;
-                    bestIsBefore = (mouseX < centerX);
-                }
-                t = t->next;
-            }
-
-            dropTarget = bestTarget;
-            dropBefore = bestIsBefore;
+            dropTarget = list.FindDropTarget(view, mouse, draggingNode, dropBefore);
         }
 
         // Drop
         if (isDragging && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
-            if (draggingNode && dropTarget && draggingNode != dropTarget) {
+            if (draggingNode != NIL && dropTarget != NIL && draggingNode != dropTarget) {
                 ClearTraversal();
+                int from = list.SlotOf(draggingNode);
+                int to = list.SlotOf(dropTarget);
                 if (dropBefore) {
-                    list.MoveNodeBefore(draggingNode, dropTarget);
+                    Run({ OpCode::MoveBefore, from, to });
                     status = "Moved node before target.";
                 } else {
-                    list.MoveNodeAfter(draggingNode, dropTarget);
+                    Run({ OpCode::MoveAfter, from, to });
                     status = "Moved node after target.";
                 }
             }
             isDragging = false;
-            draggingNode = nullptr;
-            dropTarget = nullptr;
+            draggingNode = NIL;
+            dropTarget = NIL;
         }
 
         // Buttons
         if (IsButtonClicked(btnInsertHead) && !inputBuffer.empty()) {
             ClearTraversal();
-            list.InsertHead(std::stoi(inputBuffer));
+            Run({ OpCode::InsertHead, std::stoi(inputBuffer), 0 });
             inputBuffer.clear();
             status = "Inserted at head.";
         }
         if (IsButtonClicked(btnInsertTail) && !inputBuffer.empty()) {
             ClearTraversal();
-            list.InsertTail(std::stoi(inputBuffer));
+            Run({ OpCode::InsertTail, std::stoi(inputBuffer), 0 });
             inputBuffer.clear();
             status = "Inserted at tail.";
         }
-        if (IsButtonClicked(btnDeleteHead)) { ClearTraversal(); list.DeleteHead(); status = "Deleted head."; }
-        if (IsButtonClicked(btnDeleteTail)) { ClearTraversal(); list.DeleteTail(); status = "Deleted tail."; }
+        if (IsButtonClicked(btnDeleteHead)) { ClearTraversal(); Run({ OpCode::DeleteHead, 0, 0 }); status = "Deleted head."; }
+        if (IsButtonClicked(btnDeleteTail)) { ClearTraversal(); Run({ OpCode::DeleteTail, 0, 0 }); status = "Deleted tail."; }
         if (IsButtonClicked(btnTraverse)) {
             ClearTraversal();
             travNode = list.GetHead();
-            traversing = travNode != nullptr;
-            if (travNode) travNode->highlighted = true;
+            traversing = travNode != NIL;
+            if (traversing) list.SetHighlighted(travNode, true);
             status = "Traversing...";
         }
+        if (IsButtonClicked(btnMode)) {
+            list.SetDoubly(!list.IsDoubly());
+            btnMode.label = list.IsDoubly() ? "Mode: Doubly" : "Mode: Singly";
+            status = list.IsDoubly() ? "Doubly linked: prev links rebuilt, unlink is O(1)."
+                                     : "Singly linked: predecessors found by walking.";
+        }
+        if (IsButtonClicked(btnLayout)) {
+            LayoutMode next = LayoutMode::Line;
+            if (list.GetLayout() == LayoutMode::Line) next = LayoutMode::Rows;
+            else if (list.GetLayout() == LayoutMode::Rows) next = LayoutMode::Serpentine;
+            list.SetLayout(next);
+            btnLayout.label = LayoutLabel(next);
+            status = "Layout changed.";
+        }
         if (IsButtonClicked(btnAddDummy)) {
             ClearTraversal();
-            list.InsertTail(999);  // Dummy node value
+            Run({ OpCode::InsertTail, 999, 0 });  // Dummy node value
             status = "Added dummy node (999) at tail.";
         }
 
+        // Recording starts from the current list: it is written out as
+        // tail inserts so the saved trace replays from empty
+        if (IsButtonClicked(btnRecord)) {
+            recording = !recording;
+            if (recording) {
+                trace.clear();
+                for (Ref t = list.GetHead(); t != NIL; t = list.NextOf(t))
+                    trace.push_back({ OpCode::InsertTail, list.ValueOf(t), 0 });
+                status = "Recording...";
+            } else {
+                status = TextFormat("Recorded %d ops.", (int)trace.size());
+            }
+            btnRecord.label = recording ? "Stop" : "Record";
+        }
+        if (IsButtonClicked(btnSave)) {
+            // Shift+click writes the compact binary format
+            bool binary = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+            const char* path = binary ? "list_trace.bin" : "list_trace.txt";
+            if (trace.empty()) status = "Nothing recorded yet.";
+            else if (SaveTrace(path, trace, binary))
+                status = TextFormat("Saved %d ops to %s.", (int)trace.size(), path);
+            else status = TextFormat("Could not write %s.", path);
+        }
+
+        // Every representation holds the same values, so the next one
+        // picks up where this one stops (see main)
+        if (IsButtonClicked(btnStorage)) {
+            if (app.storage == Storage::Nodes) status = "Storage: struct of arrays with 32-bit index links.";
+            else if (app.storage == Storage::Indexed) status = TextFormat("Storage: unrolled, %d values per block.", BLOCK_CAPACITY);
+            else status = "Storage: heap nodes with pointer links.";
+            return true;
+        }
+
         // Traversal animation
         if (traversing) {
             travTimer += dt;
             if (travTimer > 0.5f) {
-                if (travNode) travNode->highlighted = false;
-                travNode = travNode ? travNode->next : nullptr;
-                if (travNode) travNode->highlighted = true;
+                if (travNode != NIL) list.SetHighlighted(travNode, false);
+                travNode = travNode != NIL ? list.NextOf(travNode) : NIL;
+                if (travNode != NIL) list.SetHighlighted(travNode, true);
                 else traversing = false;
                 travTimer = 0.0f;
             }
         }
 
-        list.UpdateAnimation(dt, draggingNode);
+        list.UpdateAnimation(dt, draggingNode, view);
 
         // Draw
         BeginDrawing();
         ClearBackground(RAYWHITE);
 
+        // List first: the controls are drawn over it
+        BeginMode2D(cam);
+        list.Draw(view, selectedNode, pulse, dropTarget, isDragging, dropBefore);
+        EndMode2D();
+
         DrawText("Linked List Visualizer", 40, 20, 32, DARKBLUE);
-        DrawText("Backspace on selected node to delete", 40, 70, 20, DARKGRAY);
+        DrawText("Backspace on selected node to delete   Wheel/right-drag/arrows: zoom & pan   Home/End   F: +100k   Drop a trace file to replay",
+                 40, 70, 20, DARKGRAY);
 
         // Input box
         DrawText("Value:", 50, 320, 20, BLACK);
@@ -563,33 +2389,102 @@ int main() {
         DrawButton(btnDeleteTail);
         DrawButton(btnTraverse);
         DrawButton(btnAddDummy);  // Draw the new button
+        DrawButton(btnMode);
+        DrawButton(btnLayout);
+        DrawButton(btnRecord);
+        DrawButton(btnSave);
+        DrawButton(btnStorage);
+        if (recording) DrawCircle(210, 570, 6, Fade(RED, 0.5f + 0.5f * pulse));
 
         DrawText(status.c_str(), 50, 450, 18, DARKGRAY);
+        DrawText(TextFormat("Size: %d   (%.1f bytes/value)", list.Size(),
+                            list.Size() > 0 ? (double)list.MemoryBytes() / list.Size() : 0.0),
+                 50, 410, 20, DARKGRAY);
 
-        list.Draw(selectedNode, pulse, dropTarget, isDragging, dropBefore);
 
         // Info panel
-        if (selectedNode) {
+        if (selectedNode != NIL) {
             DrawRectangle(850, 320, 380, 160, Fade(LIGHTGRAY, 0.9f));
             DrawRectangleLines(850, 320, 380, 160, BLACK);
             DrawText("Selected Node", 870, 340, 24, BLACK);
-            DrawText(("Value: " + std::to_string(selectedNode->value)).c_str(), 870, 380, 20, BLACK);
-            std::string nextStr = selectedNode->next ? ("Next: " + std::to_string(selectedNode->next->value)) : "Next: NULL";
+            DrawText(("Value: " + std::to_string(list.ValueOf(selectedNode))).c_str(), 870, 380, 20, BLACK);
+            Ref next = list.NextOf(selectedNode);
+            std::string nextStr = next != NIL ? ("Next: " + std::to_string(list.ValueOf(next))) : "Next: NULL";
             DrawText(nextStr.c_str(), 870, 410, 20, BLACK);
 
-            Node* prev = nullptr;
-            Node* cur = list.GetHead();
-            while (cur && cur->next != selectedNode) { prev = cur; cur = cur->next; }
-            if (prev || selectedNode == list.GetHead()) {
-                std::string prevMsg;
-                if (prev) prevMsg = "Prev: " + std::to_string(prev->value);
-                else prevMsg = "Prev: NULL";
-                DrawText(prevMsg.c_str(), 870, 440, 20, BLACK);
-            }
+            Ref prev = list.PrevOf(selectedNode);
+            std::string prevMsg;
+            if (prev != NIL) prevMsg = "Prev: " + std::to_string(list.ValueOf(prev));
+            else prevMsg = "Prev: NULL";
+            DrawText(prevMsg.c_str(), 870, 440, 20, BLACK);
         }
 
         EndDrawing();
     }
+    return false;
+}
+
+// ==========================================================
+// MAIN
+// ==========================================================
+// Headless:  LinkedLists --replay trace.txt   → apply at full speed on every
+//                                               representation, print ops/sec
+//            LinkedLists --gen N trace.txt  → write a random N-op trace
+//            LinkedLists --bench [N]        → memory and traversal per value
+int main(int argc, char** argv) {
+    if (argc >= 3 && strcmp(argv[1], "--replay") == 0) {
+        std::vector<ListOp> ops;
+        std::string error;
+        if (!LoadTrace(argv[2], ops, error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        LinkedList nodes;
+        IndexedList indexed;
+        UnrolledList unrolled;
+        double seconds[3] = { ReplayTrace(nodes, ops), ReplayTrace(indexed, ops), ReplayTrace(unrolled, ops) };
+
+        std::cout << ops.size() << " ops, final size " << nodes.Size() << "\n";
+        for (int i = 0; i < 3; i++)
+            printf("  %-9s %10.2f ms %12.0f ops/s\n", STORAGE_NAMES[i], seconds[i] * 1000.0,
+                   seconds[i] > 0 ? ops.size() / seconds[i] : 0.0);
+        return 0;
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) {
+        RunStorageBench(argc >= 3 ? std::max(1, atoi(argv[2])) : 1000000);
+        return 0;
+    }
+    if (argc >= 4 && strcmp(argv[1], "--gen") == 0) {
+        std::vector<ListOp> ops = GenerateTrace(std::max(0, atoi(argv[2])), 12345);
+        bool binary = std::string(argv[3]).find(".txt") == std::string::npos;
+        if (!SaveTrace(argv[3], ops, binary)) {
+            std::cerr << "cannot write " << argv[3] << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Linked List Visualiser - Drag & Drop + Dummy Node");
+    SetTargetFPS(60);
+
+    AppState app;
+    LinkedList nodes;
+    IndexedList indexed;
+    UnrolledList unrolled;
+
+    // The Storage button hands the list on: Nodes → SoA → Unrolled → Nodes
+    while (true) {
+        bool next = app.storage == Storage::Nodes   ? RunVisualizer(nodes, app)
+                  : app.storage == Storage::Indexed ? RunVisualizer(indexed, app)
+                                                    : RunVisualizer(unrolled, app);
+        if (!next) break;
+
+        switch (app.storage) {
+        case Storage::Nodes:    CopyList(nodes, indexed);    nodes.Clear();    app.storage = Storage::Indexed;  break;
+        case Storage::Indexed:  CopyList(indexed, unrolled); indexed.Clear();  app.storage = Storage::Unrolled; break;
+        case Storage::Unrolled: CopyList(unrolled, nodes);   unrolled.Clear(); app.storage = Storage::Nodes;    break;
+        }
+    }
 
     CloseWindow();
     return 0;
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ==========================================================
+// NODE POOL (slab allocator)
+// ==========================================================
+// Shared by the BST and linked-list visualizers.
+//
+// Nodes are carved out of fixed-size slabs, so neighbouring
+// nodes sit next to each other in memory instead of being
+// scattered by individual new/delete calls.
+//
+// Create  → reuse a freed slot, otherwise take the next slab slot
+// Destroy → push the slot onto the free list (O(1))
+// Reset   → forget every node at once (O(1), slabs are kept)
+//
+// Reset never runs destructors, so T must be trivially
+// destructible (both Node structs are plain data).
+// ==========================================================
+template <typename T, size_t SLAB_SIZE = 4096>
+class NodePool {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "NodePool::Reset skips destructors");
+
+public:
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        for (T* slab : slabs) ::operator delete(slab);
+    }
+
+    template <typename... Args>
+    T* Create(Args&&... args) {
+        void* slot;
+        if (!freeList.empty()) {
+            slot = freeList.back();
+            freeList.pop_back();
+        } else {
+            if (used == slabs.size() * SLAB_SIZE)
+                slabs.push_back(static_cast<T*>(::operator new(sizeof(T) * SLAB_SIZE)));
+            slot = slabs[used / SLAB_SIZE] + used % SLAB_SIZE;
+            used++;
+        }
+        live++;
+        return new (slot) T(std::forward<Args>(args)...);
+    }
+
+    void Destroy(T* node) {
+        if (!node) return;
+        freeList.push_back(node);
+        live--;
+    }
+
+    void Reset() {
+        freeList.clear();
+        used = 0;
+        live = 0;
+    }
+
+    size_t Live() const { return live; }
+    size_t Capacity() const { return slabs.size() * SLAB_SIZE; }
+
+private:
+    std::vector<T*> slabs;
+    std::vector<T*> freeList;
+    size_t used = 0;   // slab slots handed out since the last Reset
+    size_t live = 0;   // nodes currently in use
+};
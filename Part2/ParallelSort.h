@@ -0,0 +1,443 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "SortCore.h"
+
+// =====================================================================
+// PARALLEL SORT CORE (no raylib)
+// =====================================================================
+// Parallel merge sort and quicksort on a small work-stealing pool,
+// plus CompareParallel, which times each against the sequential
+// SortCore.h version of the same algorithm.
+//
+// WorkStealingPool → one task deque per thread. The owner pushes
+//                    and pops at the back (newest, smallest task
+//                    first); an idle thread steals from the front
+//                    of someone else's deque (oldest, biggest).
+// TaskGroup        → fork/join: Run() forks a task, Wait() keeps
+//                    running queued tasks until its own are done,
+//                    so a waiting thread never sits idle.
+//
+// Both sorts split until a piece is "grain" elements, then hand it
+// to the sequential SortCore code. `owner[i]` records which thread
+// sorted that piece, for the per-thread partition colours.
+// =====================================================================
+
+// Index of the pool thread running this code; -1 outside a pool
+inline int& WorkerIndex()
+{
+    thread_local int index = -1;
+    return index;
+}
+
+class WorkStealingPool
+{
+public:
+    using Task = std::function<void()>;
+
+    // `workers` threads of its own; the thread calling Run() joins
+    // in as one more, so Threads() = workers + 1
+    explicit WorkStealingPool(int workers)
+        : queues(workers + 1)
+    {
+        for (auto& q : queues)
+            q = std::make_unique<Queue>();
+
+        for (int i = 0; i < workers; ++i)
+            threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : threads)
+            t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int Threads() const { return (int)queues.size(); }
+
+    // Runs `root` on the calling thread as the last worker index.
+    // One caller at a time.
+    void Run(const Task& root)
+    {
+        int previous = WorkerIndex();
+        WorkerIndex() = Threads() - 1;
+        root();
+        WorkerIndex() = previous;
+    }
+
+    void Submit(Task task)
+    {
+        int self = WorkerIndex();
+        Queue& q = *queues[self >= 0 ? self : Threads() - 1];
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+        }
+        queued++;
+
+        // Empty lock: a worker between its check and its wait can't miss this
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_one();
+    }
+
+    // Runs one queued task (own deque first, then steal); false if
+    // every deque was empty
+    bool RunOne()
+    {
+        int   self = WorkerIndex();
+        int   n    = Threads();
+        Task  task;
+
+        if (self >= 0 && PopBack(*queues[self], task))
+        {
+            task();
+            return true;
+        }
+        for (int k = 1; k <= n; ++k)
+        {
+            int victim = ((self >= 0 ? self : 0) + k) % n;
+            if (PopFront(*queues[victim], task))
+            {
+                task();
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread>            threads;
+
+    std::atomic<int>        queued { 0 };
+    std::mutex              sleepMutex;
+    std::condition_variable wake;
+    bool                    stopping = false;
+
+    bool PopBack(Queue& q, Task& out)
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty())
+            return false;
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        queued--;
+        return true;
+    }
+
+    bool PopFront(Queue& q, Task& out)
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty())
+            return false;
+        out = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        queued--;
+        return true;
+    }
+
+    void WorkerLoop(int index)
+    {
+        WorkerIndex() = index;
+        for (;;)
+        {
+            if (RunOne())
+                continue;
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this]() { return stopping || queued > 0; });
+            if (stopping)
+                return;
+        }
+    }
+};
+
+class TaskGroup
+{
+public:
+    explicit TaskGroup(WorkStealingPool& pool) : pool(pool) {}
+    ~TaskGroup() { Wait(); }
+
+    void Run(std::function<void()> task)
+    {
+        pending++;
+        pool.Submit([this, task = std::move(task)]()
+        {
+            task();
+
+            // Under the lock, so Wait can't return (and the group go
+            // away) between the decrement and the notify
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0)
+                done.notify_all();
+        });
+    }
+
+    // Every deque empty → the rest of the group is running on other
+    // threads, so sleep until it finishes. The timeout sends the
+    // thread back to stealing in case those tasks fork more work.
+    void Wait()
+    {
+        while (pending > 0)
+        {
+            if (pool.RunOne())
+                continue;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait_for(lock, std::chrono::microseconds(200), [this]() { return pending == 0; });
+        }
+
+        // The last task may still be holding the lock
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+
+private:
+    WorkStealingPool&       pool;
+    std::atomic<int>        pending { 0 };
+    std::mutex              mutex;
+    std::condition_variable done;
+};
+
+// ---------------------------------------------------------
+// Parallel merge sort
+// ---------------------------------------------------------
+// Same scheme as MergeSortRange: both halves sorted (in parallel),
+// copied to `buf`, merged back. Big merges are split too: the
+// middle of the longer run and its lower/upper bound in the other
+// run cut the merge into two independent ones (equal keys still
+// take the left run first, so it stays stable).
+// ---------------------------------------------------------
+struct ParallelSortContext
+{
+    WorkStealingPool&     pool;
+    std::vector<int>&     data;
+    std::vector<int>      buf;
+    std::vector<uint8_t>* owner;
+    int                   grain;
+
+    void MarkOwner(int lo, int hi)
+    {
+        if (owner)
+            std::fill(owner->begin() + lo, owner->begin() + hi, (uint8_t)WorkerIndex());
+    }
+};
+
+// Merges buf[i0, i1) and buf[j0, j1) into data[k, ...)
+inline void ParallelMergeRuns(ParallelSortContext& ctx, int i0, int i1, int j0, int j1, int k)
+{
+    const int* b = ctx.buf.data();
+
+    if ((i1 - i0) + (j1 - j0) <= ctx.grain)
+    {
+        int* out = ctx.data.data() + k;
+        while (i0 < i1 && j0 < j1)
+            *out++ = (b[j0] < b[i0]) ? b[j0++] : b[i0++];
+        out = std::copy(b + i0, b + i1, out);
+        std::copy(b + j0, b + j1, out);
+        return;
+    }
+
+    int im, jm;
+    if (i1 - i0 >= j1 - j0)
+    {
+        im = i0 + (i1 - i0) / 2;
+        jm = (int)(std::lower_bound(b + j0, b + j1, b[im]) - b);
+    }
+    else
+    {
+        jm = j0 + (j1 - j0) / 2;
+        im = (int)(std::upper_bound(b + i0, b + i1, b[jm]) - b);
+    }
+
+    TaskGroup group(ctx.pool);
+    group.Run([&]() { ParallelMergeRuns(ctx, i0, im, j0, jm, k); });
+    ParallelMergeRuns(ctx, im, i1, jm, j1, k + (im - i0) + (jm - j0));
+    group.Wait();
+}
+
+inline void ParallelMergeSortRange(ParallelSortContext& ctx, int lo, int hi)
+{
+    if (hi - lo <= ctx.grain)
+    {
+        PlainArray arr(ctx.data);
+        MergeSortRange(arr, ctx.buf, lo, hi);
+        ctx.MarkOwner(lo, hi);
+        return;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    {
+        TaskGroup group(ctx.pool);
+        group.Run([&]() { ParallelMergeSortRange(ctx, lo, mid); });
+        ParallelMergeSortRange(ctx, mid, hi);
+        group.Wait();
+    }
+
+    // Copy in grain-sized slices so the copy is spread out as well
+    {
+        TaskGroup group(ctx.pool);
+        for (int s = lo; s < hi; s += ctx.grain)
+        {
+            int e = std::min(hi, s + ctx.grain);
+            group.Run([&ctx, s, e]()
+            {
+                std::copy(ctx.data.begin() + s, ctx.data.begin() + e, ctx.buf.begin() + s);
+            });
+        }
+        group.Wait();
+    }
+
+    ParallelMergeRuns(ctx, lo, mid, mid, hi, lo);
+}
+
+// ---------------------------------------------------------
+// Parallel quicksort
+// ---------------------------------------------------------
+// PartitionHoare on the calling thread, then the smaller side is
+// forked and the thread loops on the larger, like QuickSortHoare.
+// The first partitions touch the whole array on one thread, which
+// is what caps the speedup compared to merge sort.
+//
+// `depth` is IntroSort's budget (2 log2 n partitions): a range
+// that runs it out on bad pivots is finished by IntroSortRange.
+// ---------------------------------------------------------
+inline void ParallelQuickSortRange(ParallelSortContext& ctx, int lo, int hi, int depth)
+{
+    PlainArray arr(ctx.data);
+    TaskGroup  group(ctx.pool);
+
+    while (hi - lo > ctx.grain)
+    {
+        if (depth-- == 0)
+        {
+            int budget = 0;
+            for (int n = hi - lo; n > 1; n >>= 1)
+                budget += 2;
+            IntroSortRange(arr, lo, hi, budget);
+            ctx.MarkOwner(lo, hi);
+            group.Wait();
+            return;
+        }
+
+        int j = PartitionHoare(arr, lo, hi);
+        if (j + 1 - lo < hi - j - 1)
+        {
+            group.Run([&ctx, lo, j, depth]() { ParallelQuickSortRange(ctx, lo, j + 1, depth); });
+            lo = j + 1;
+        }
+        else
+        {
+            group.Run([&ctx, j, hi, depth]() { ParallelQuickSortRange(ctx, j + 1, hi, depth); });
+            hi = j + 1;
+        }
+    }
+
+    QuickSortHoare(arr, lo, hi);
+    ctx.MarkOwner(lo, hi);
+    group.Wait();
+}
+
+// ---------------------------------------------------------
+// Sequential vs parallel
+// ---------------------------------------------------------
+enum class ParallelAlgorithm
+{
+    Merge,
+    Quick,
+    Count
+};
+
+const char* const PARALLEL_NAMES[] =
+{
+    "Parallel merge sort",
+    "Parallel quicksort"
+};
+
+struct ParallelResult
+{
+    ParallelAlgorithm    algorithm = ParallelAlgorithm::Merge;
+    int                  threads   = 0;
+    double               sequentialMs = 0.0;
+    double               parallelMs   = 0.0;
+    std::vector<int>     sorted;
+    std::vector<uint8_t> owner;      // thread that sorted each index's piece
+};
+
+// Sorts `values` twice: once with the plain SortCore algorithm on
+// one thread, once in parallel on `pool`
+inline ParallelResult CompareParallel(ParallelAlgorithm algorithm, const std::vector<int>& values,
+                                      WorkStealingPool& pool)
+{
+    using Clock = std::chrono::steady_clock;
+    auto Ms = [](Clock::time_point a, Clock::time_point b)
+    {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+
+    ParallelResult r;
+    r.algorithm = algorithm;
+    r.threads   = pool.Threads();
+
+    int n = (int)values.size();
+
+    std::vector<int> seq = values;
+    {
+        PlainArray arr(seq);
+        auto t0 = Clock::now();
+        if (algorithm == ParallelAlgorithm::Merge)
+            MergeSort(arr);
+        else
+            QuickSortHoare(arr, 0, n);
+        r.sequentialMs = Ms(t0, Clock::now());
+    }
+
+    r.sorted = values;
+    r.owner.assign(n, 0);
+
+    // ~8 pieces per thread, so stealing can even out uneven ones
+    int grain = std::max(4096, n / (r.threads * 8));
+    ParallelSortContext ctx { pool, r.sorted, {}, &r.owner, grain };
+
+    auto t0 = Clock::now();
+    if (algorithm == ParallelAlgorithm::Merge)
+    {
+        ctx.buf.resize(n);
+        pool.Run([&]() { ParallelMergeSortRange(ctx, 0, n); });
+    }
+    else
+    {
+        int depth = 0;
+        for (int m = n; m > 1; m >>= 1)
+            depth += 2;
+        pool.Run([&]() { ParallelQuickSortRange(ctx, 0, n, depth); });
+    }
+    r.parallelMs = Ms(t0, Clock::now());
+
+    return r;
+}
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+// =====================================================================
+// SIMD SORT KERNELS (no raylib)
+// =====================================================================
+// Merge sort over plain ints with the inner loops in vector
+// registers of SIMD_LANES ints:
+//
+//   1. Blocks of LANES × LANES values are loaded as LANES registers
+//      and sorted column-wise by a sorting network (each comparator
+//      is one min + one max over all lanes), then transposed, so
+//      every register holds a sorted run of LANES.
+//   2. Runs are merged pairwise, LANES values per step: a bitonic
+//      merge network of two registers (reverse one, min/max, then
+//      three in-register min/max rounds) emits the lower LANES and
+//      keeps the upper LANES for the next step.
+//
+// The instruction set is picked at compile time:
+//   AVX2    → 8 lanes   (-mavx2 or -march=native, MSVC /arch:AVX2)
+//   SSE4.1  → 4 lanes   (-msse4.1, MSVC /arch:AVX)
+//   neither → the same steps on plain 4-int structs, so the sort
+//             still works, just without the vector speedup
+//
+// The input is padded with INT_MAX up to a whole number of blocks.
+// =====================================================================
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define SIMD_KERNEL_NAME "AVX2"
+    const int SIMD_LANES = 8;
+#elif defined(__SSE4_1__) || defined(__AVX__)
+    #include <smmintrin.h>
+    #define SIMD_KERNEL_NAME "SSE4.1"
+    const int SIMD_LANES = 4;
+#else
+    #define SIMD_KERNEL_NAME "scalar"
+    const int SIMD_LANES = 4;
+#endif
+
+const int SIMD_BLOCK = SIMD_LANES * SIMD_LANES;
+
+// Sorting network for SIMD_LANES inputs, as (i, j) comparators:
+// after it, input i <= input j for every i < j
+#if defined(__AVX2__)
+const int SIMD_NETWORK[][2] =
+{
+    {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    {0, 1}, {2, 3}, {4, 5}, {6, 7},
+    {2, 4}, {3, 5},
+    {1, 4}, {3, 6},
+    {1, 2}, {3, 4}, {5, 6}
+};
+#else
+const int SIMD_NETWORK[][2] =
+{
+    {0, 1}, {2, 3},
+    {0, 2}, {1, 3},
+    {1, 2}
+};
+#endif
+const int SIMD_NETWORK_SIZE = sizeof(SIMD_NETWORK) / sizeof(SIMD_NETWORK[0]);
+
+namespace simd
+{
+
+// ---------------------------------------------------------
+// Registers
+// ---------------------------------------------------------
+#if defined(__AVX2__)
+
+typedef __m256i Vec;
+
+inline Vec  Load(const int* p)        { return _mm256_loadu_si256((const __m256i*)p); }
+inline void Store(int* p, Vec v)      { _mm256_storeu_si256((__m256i*)p, v); }
+inline Vec  Min(Vec a, Vec b)         { return _mm256_min_epi32(a, b); }
+inline Vec  Max(Vec a, Vec b)         { return _mm256_max_epi32(a, b); }
+inline Vec  Reverse(Vec v)            { return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+
+// Bitonic → sorted: compare lanes 4, 2, then 1 apart
+inline Vec BitonicSort(Vec v)
+{
+    Vec p = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(Min(v, p), Max(v, p), 0xF0);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(Min(v, p), Max(v, p), 0xCC);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_blend_epi32(Min(v, p), Max(v, p), 0xAA);
+}
+
+inline void Transpose(Vec* r)
+{
+    Vec t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    Vec t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    Vec t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    Vec t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    Vec t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    Vec t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    Vec t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    Vec t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+    Vec u0 = _mm256_unpacklo_epi64(t0, t2);
+    Vec u1 = _mm256_unpackhi_epi64(t0, t2);
+    Vec u2 = _mm256_unpacklo_epi64(t1, t3);
+    Vec u3 = _mm256_unpackhi_epi64(t1, t3);
+    Vec u4 = _mm256_unpacklo_epi64(t4, t6);
+    Vec u5 = _mm256_unpackhi_epi64(t4, t6);
+    Vec u6 = _mm256_unpacklo_epi64(t5, t7);
+    Vec u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+#elif defined(__SSE4_1__) || defined(__AVX__)
+
+typedef __m128i Vec;
+
+inline Vec  Load(const int* p)        { return _mm_loadu_si128((const __m128i*)p); }
+inline void Store(int* p, Vec v)      { _mm_storeu_si128((__m128i*)p, v); }
+inline Vec  Min(Vec a, Vec b)         { return _mm_min_epi32(a, b); }
+inline Vec  Max(Vec a, Vec b)         { return _mm_max_epi32(a, b); }
+inline Vec  Reverse(Vec v)            { return _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+// Bitonic → sorted: compare lanes 2, then 1 apart
+inline Vec BitonicSort(Vec v)
+{
+    Vec p = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm_blend_epi16(Min(v, p), Max(v, p), 0xF0);
+
+    p = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_blend_epi16(Min(v, p), Max(v, p), 0xCC);
+}
+
+inline void Transpose(Vec* r)
+{
+    Vec t0 = _mm_unpacklo_epi32(r[0], r[1]);
+    Vec t1 = _mm_unpackhi_epi32(r[0], r[1]);
+    Vec t2 = _mm_unpacklo_epi32(r[2], r[3]);
+    Vec t3 = _mm_unpackhi_epi32(r[2], r[3]);
+
+    r[0] = _mm_unpacklo_epi64(t0, t2);
+    r[1] = _mm_unpackhi_epi64(t0, t2);
+    r[2] = _mm_unpacklo_epi64(t1, t3);
+    r[3] = _mm_unpackhi_epi64(t1, t3);
+}
+
+#else
+
+struct Vec
+{
+    int x[SIMD_LANES];
+};
+
+inline Vec Load(const int* p)
+{
+    Vec v;
+    std::copy(p, p + SIMD_LANES, v.x);
+    return v;
+}
+
+inline void Store(int* p, Vec v) { std::copy(v.x, v.x + SIMD_LANES, p); }
+
+inline Vec Min(Vec a, Vec b)
+{
+    for (int i = 0; i < SIMD_LANES; ++i) a.x[i] = std::min(a.x[i], b.x[i]);
+    return a;
+}
+
+inline Vec Max(Vec a, Vec b)
+{
+    for (int i = 0; i < SIMD_LANES; ++i) a.x[i] = std::max(a.x[i], b.x[i]);
+    return a;
+}
+
+inline Vec Reverse(Vec v)
+{
+    std::reverse(v.x, v.x + SIMD_LANES);
+    return v;
+}
+
+inline Vec BitonicSort(Vec v)
+{
+    for (int d = SIMD_LANES / 2; d > 0; d /= 2)
+    {
+        for (int i = 0; i < SIMD_LANES; ++i)
+        {
+            if ((i & d) == 0 && v.x[i + d] < v.x[i])
+                std::swap(v.x[i], v.x[i + d]);
+        }
+    }
+    return v;
+}
+
+inline void Transpose(Vec* r)
+{
+    for (int i = 0; i < SIMD_LANES; ++i)
+        for (int j = i + 1; j < SIMD_LANES; ++j)
+            std::swap(r[i].x[j], r[j].x[i]);
+}
+
+#endif
+
+// a, b sorted → a = lower half, b = upper half of both, each sorted
+inline void MergeRegisters(Vec& a, Vec& b)
+{
+    Vec r = Reverse(b);
+    Vec lo = Min(a, r);
+    Vec hi = Max(a, r);
+    a = BitonicSort(lo);
+    b = BitonicSort(hi);
+}
+
+// Sorts one SIMD_BLOCK in place into SIMD_LANES sorted runs of SIMD_LANES
+inline void SortBlock(int* p)
+{
+    Vec r[SIMD_LANES];
+    for (int i = 0; i < SIMD_LANES; ++i)
+        r[i] = Load(p + i * SIMD_LANES);
+
+    for (int k = 0; k < SIMD_NETWORK_SIZE; ++k)
+    {
+        Vec& x = r[SIMD_NETWORK[k][0]];
+        Vec& y = r[SIMD_NETWORK[k][1]];
+        Vec  t = Min(x, y);
+        y = Max(x, y);
+        x = t;
+    }
+
+    Transpose(r);
+    for (int i = 0; i < SIMD_LANES; ++i)
+        Store(p + i * SIMD_LANES, r[i]);
+}
+
+// Merges sorted a[0, na) and b[0, nb) into out; both lengths are
+// whole, non-zero multiples of SIMD_LANES
+inline void MergeRuns(const int* a, int na, const int* b, int nb, int* out)
+{
+    const int* aEnd = a + na;
+    const int* bEnd = b + nb;
+
+    Vec lo = Load(a);
+    Vec hi = Load(b);
+    a += SIMD_LANES;
+    b += SIMD_LANES;
+
+    for (;;)
+    {
+        MergeRegisters(lo, hi);
+        Store(out, lo);
+        out += SIMD_LANES;
+
+        // Next LANES come from the run with the smaller head
+        if (a < aEnd && (b == bEnd || *a < *b))
+        {
+            lo = Load(a);
+            a += SIMD_LANES;
+        }
+        else if (b < bEnd)
+        {
+            lo = Load(b);
+            b += SIMD_LANES;
+        }
+        else
+        {
+            break;
+        }
+    }
+    Store(out, hi);
+}
+
+} // namespace simd
+
+// Sorts data[0, n) ascending
+inline void SimdSort(int* data, int n)
+{
+    if (n < 2)
+        return;
+
+    // Sort in place when n is whole blocks, otherwise in a padded copy
+    int padded = (n + SIMD_BLOCK - 1) / SIMD_BLOCK * SIMD_BLOCK;
+    std::vector<int> copy;
+    int* work = data;
+    if (padded != n)
+    {
+        copy.assign(padded, INT_MAX);
+        std::copy(data, data + n, copy.begin());
+        work = copy.data();
+    }
+
+    for (int base = 0; base < padded; base += SIMD_BLOCK)
+        simd::SortBlock(work + base);
+
+    // Bottom-up merge passes, back and forth between work and tmp
+    std::vector<int> tmp(padded);
+    int* src = work;
+    int* dst = tmp.data();
+    for (int width = SIMD_LANES; width < padded; width *= 2)
+    {
+        for (int lo = 0; lo < padded; lo += 2 * width)
+        {
+            int mid = std::min(lo + width, padded);
+            int hi  = std::min(lo + 2 * width, padded);
+            if (mid == hi)
+                std::copy(src + lo, src + hi, dst + lo);
+            else
+                simd::MergeRuns(src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+        std::copy(src, src + n, data);
+}
@@ -0,0 +1,86 @@
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include "SortCore.h"
+using namespace std;
+
+// ============================================================
+// SORT BENCHMARK (headless, no raylib)
+// ============================================================
+// Sorts random ints at 2^10 .. 2^24 values three ways:
+//
+//   std::sort → the library introsort
+//   scalar    → MergeSort from SortCore.h on a PlainArray
+//   simd      → SimdSort from SimdSort.h (the vector kernels the
+//               visualizer's "SIMD merge" algorithm runs)
+//
+// Each row reports throughput in millions of values per second
+// (best of several runs, small sizes repeated so every run takes
+// a few milliseconds) and the SIMD speedup over the other two.
+//
+// Which kernels get compiled depends on the flags, e.g.
+//   g++ -O2 -march=native SortBenchmark.cpp    → AVX2 if the CPU has it
+//   g++ -O2 -msse4.1 SortBenchmark.cpp         → SSE4.1
+//   g++ -O2 SortBenchmark.cpp                  → scalar stand-in
+//
+// Usage: SortBenchmark [maxValues]   (default 16777216)
+// ============================================================
+
+typedef chrono::steady_clock Clock;
+
+const int    RUNS           = 5;
+const double MIN_RUN_VALUES = 1 << 20;   // values sorted per timed run, at least
+
+// Best throughput (M values/s) of `sorter` over RUNS runs on copies
+// of `input`. Every copy is checked against `expected`.
+template <typename Sorter>
+double timeSorter(const vector<int>& input, const vector<int>& expected, Sorter sorter, bool& ok) {
+    int n = (int)input.size();
+    int reps = max(1, (int)(MIN_RUN_VALUES / n));
+    vector<vector<int>> copies(reps);
+
+    double best = 0;
+    for (int run = 0; run < RUNS; run++) {
+        for (auto& c : copies) c = input;
+
+        auto start = Clock::now();
+        for (auto& c : copies) sorter(c);
+        double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+        best = max(best, (double)n * reps / seconds / 1e6);
+        for (auto& c : copies) ok &= (c == expected);
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    int maxValues = 1 << 24;
+    if (argc > 1) maxValues = max(1024, atoi(argv[1]));
+
+    mt19937 rng(12345);
+
+    printf("Sort benchmark (SIMD kernels: %s, %d lanes)\n", SIMD_KERNEL_NAME, SIMD_LANES);
+    printf("%10s %11s %11s %11s %11s %11s\n",
+           "values", "std::sort", "scalar", "simd", "vs std", "vs scalar");
+
+    for (int n = 1024; n <= maxValues; n *= 4) {
+        vector<int> input(n);
+        for (auto& v : input) v = (int)rng();
+        vector<int> expected = input;
+        sort(expected.begin(), expected.end());
+
+        bool ok = true;
+        double stdRate = timeSorter(input, expected, [](vector<int>& v) { sort(v.begin(), v.end()); }, ok);
+        double scalarRate = timeSorter(input, expected, [](vector<int>& v) { PlainArray a(v); MergeSort(a); }, ok);
+        double simdRate = timeSorter(input, expected, [](vector<int>& v) { SimdSort(v.data(), (int)v.size()); }, ok);
+
+        printf("%10d %11.1f %11.1f %11.1f %10.2fx %10.2fx\n",
+               n, stdRate, scalarRate, simdRate, simdRate / stdRate, simdRate / scalarRate);
+        if (!ok) printf("  !! n = %d: a sorter returned the wrong order\n", n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,718 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "SimdSort.h"
+
+// =====================================================================
+// SORT CORE (no raylib)
+// =====================================================================
+// The sorting algorithms behind the array visualizer, written once
+// against a small array interface so the same code can run two ways:
+//
+//   PlainArray  → bare int array, nothing recorded (for timing)
+//   TracedArray → reports every Compare / Swap / Write / Lock as a
+//                 SortEvent, which is what the visualizer animates
+//
+// Array interface used by the algorithms:
+//   Size()                  number of elements
+//   Get(i)                  read a[i] (not an event: reads are free)
+//   Less(i, j)              a[i] < a[j]                     → Compare(i, j)
+//   LessValues(x, y, i, j)  x < y for values held outside the array
+//                           (merge buffer, pivot) that came from /
+//                           belong at i and j              → Compare(i, j)
+//   Swap(i, j)                                              → Swap(i, j)
+//   Write(i, v)             a[i] = v                        → Write(i, v)
+//   Lock(i)                 a[i] is in its final place      → Lock(i)
+//
+// RecordSort (bottom of the file) runs a traced sort to the end and
+// keeps the events in a compact, seekable SortLog.
+// =====================================================================
+
+// ---------------------------------------------------------
+// Events
+// ---------------------------------------------------------
+// Compare: a, b = indices compared
+// Swap:    a, b = indices swapped
+// Write:   a = index, b = value written
+// Lock:    a = index now final
+// ---------------------------------------------------------
+enum class SortEventType : uint8_t
+{
+    Compare,
+    Swap,
+    Write,
+    Lock
+};
+
+struct SortEvent
+{
+    SortEventType type;
+    int           a;
+    int           b;
+};
+
+// ---------------------------------------------------------
+// Array adapters
+// ---------------------------------------------------------
+struct PlainArray
+{
+    int* a;
+    int  n;
+
+    PlainArray(std::vector<int>& data) : a(data.data()), n((int)data.size()) {}
+
+    int  Size() const                            { return n; }
+    int  Get(int i) const                        { return a[i]; }
+    bool Less(int i, int j) const                { return a[i] < a[j]; }
+    bool LessValues(int x, int y, int, int) const { return x < y; }
+    void Swap(int i, int j)                      { std::swap(a[i], a[j]); }
+    void Write(int i, int v)                     { a[i] = v; }
+    void Lock(int)                               {}
+};
+
+// Events are handed to `sink` in chunks of CHUNK rather than one at
+// a time; Flush() passes on whatever is left once the sort returns.
+class TracedArray
+{
+public:
+    static constexpr size_t CHUNK = 4096;
+
+    TracedArray(std::vector<int>& data, std::function<void(std::vector<SortEvent>&)> sink)
+        : a(data.data()), n((int)data.size()), sink(std::move(sink))
+    {
+        pending.reserve(CHUNK);
+    }
+
+    int  Size() const   { return n; }
+    int  Get(int i) const { return a[i]; }
+
+    bool Less(int i, int j)
+    {
+        Emit(SortEventType::Compare, i, j);
+        return a[i] < a[j];
+    }
+
+    bool LessValues(int x, int y, int i, int j)
+    {
+        Emit(SortEventType::Compare, i, j);
+        return x < y;
+    }
+
+    void Swap(int i, int j)
+    {
+        Emit(SortEventType::Swap, i, j);
+        std::swap(a[i], a[j]);
+    }
+
+    void Write(int i, int v)
+    {
+        Emit(SortEventType::Write, i, v);
+        a[i] = v;
+    }
+
+    void Lock(int i)
+    {
+        Emit(SortEventType::Lock, i, 0);
+    }
+
+    void Flush()
+    {
+        if (!pending.empty())
+            sink(pending);
+        pending.clear();
+    }
+
+private:
+    void Emit(SortEventType type, int i, int j)
+    {
+        pending.push_back({ type, i, j });
+        if (pending.size() >= CHUNK)
+            Flush();
+    }
+
+    int*                                          a;
+    int                                           n;
+    std::function<void(std::vector<SortEvent>&)>  sink;
+    std::vector<SortEvent>                        pending;
+};
+
+// ---------------------------------------------------------
+// Algorithms
+// ---------------------------------------------------------
+// All sort ascending. Ranges are half-open [lo, hi).
+// ---------------------------------------------------------
+
+// Bubble sort: after pass i, index n-1-i is final
+template <class A>
+void BubbleSort(A& arr)
+{
+    int n = arr.Size();
+    for (int i = 0; i < n - 1; ++i)
+    {
+        for (int j = 0; j < n - 1 - i; ++j)
+        {
+            if (arr.Less(j + 1, j))
+                arr.Swap(j, j + 1);
+        }
+        arr.Lock(n - 1 - i);
+    }
+    if (n > 0)
+        arr.Lock(0);
+}
+
+template <class A>
+void InsertionSort(A& arr, int lo, int hi)
+{
+    for (int i = lo + 1; i < hi; ++i)
+    {
+        for (int j = i; j > lo && arr.Less(j, j - 1); --j)
+            arr.Swap(j, j - 1);
+    }
+}
+
+// Selection sort: the minimum of [i, n) goes to i, which is then final
+template <class A>
+void SelectionSort(A& arr)
+{
+    int n = arr.Size();
+    for (int i = 0; i < n; ++i)
+    {
+        int m = i;
+        for (int j = i + 1; j < n; ++j)
+        {
+            if (arr.Less(j, m))
+                m = j;
+        }
+        if (m != i)
+            arr.Swap(i, m);
+        arr.Lock(i);
+    }
+}
+
+// Shell sort with Ciura's gaps, extended by x2.25 for large n
+template <class A>
+void ShellSort(A& arr)
+{
+    int n = arr.Size();
+
+    std::vector<int> gaps = { 1, 4, 10, 23, 57, 132, 301, 701, 1750 };
+    while (gaps.back() < n / 2)
+        gaps.push_back((int)(gaps.back() * 2.25));
+
+    for (int g = (int)gaps.size() - 1; g >= 0; --g)
+    {
+        int gap = gaps[g];
+        for (int i = gap; i < n; ++i)
+        {
+            for (int j = i; j >= gap && arr.Less(j, j - gap); j -= gap)
+                arr.Swap(j, j - gap);
+        }
+    }
+}
+
+// Top-down merge sort. Each half is copied into `buf` and merged back
+// with writes, so compares name the slots the two values came from.
+// MergeHalves: sorted [lo, mid) + [mid, hi) → sorted [lo, hi).
+template <class A>
+void MergeHalves(A& arr, std::vector<int>& buf, int lo, int mid, int hi)
+{
+    for (int k = lo; k < hi; ++k)
+        buf[k] = arr.Get(k);
+
+    int i = lo;
+    int j = mid;
+    for (int k = lo; k < hi; ++k)
+    {
+        if (j >= hi || (i < mid && !arr.LessValues(buf[j], buf[i], j, i)))
+            arr.Write(k, buf[i++]);
+        else
+            arr.Write(k, buf[j++]);
+    }
+}
+
+template <class A>
+void MergeSortRange(A& arr, std::vector<int>& buf, int lo, int hi)
+{
+    if (hi - lo < 2)
+        return;
+
+    int mid = lo + (hi - lo) / 2;
+    MergeSortRange(arr, buf, lo, mid);
+    MergeSortRange(arr, buf, mid, hi);
+    MergeHalves(arr, buf, lo, mid, hi);
+}
+
+template <class A>
+void MergeSort(A& arr)
+{
+    std::vector<int> buf(arr.Size());
+    MergeSortRange(arr, buf, 0, arr.Size());
+}
+
+// Median of lo, mid and hi-1, moved to `to`
+template <class A>
+void MedianOfThree(A& arr, int lo, int hi, int to)
+{
+    int mid = lo + (hi - lo) / 2;
+    int last = hi - 1;
+
+    if (arr.Less(mid, lo))   arr.Swap(mid, lo);
+    if (arr.Less(last, mid)) arr.Swap(last, mid);
+    if (arr.Less(mid, lo))   arr.Swap(mid, lo);
+
+    if (mid != to)
+        arr.Swap(mid, to);
+}
+
+// Lomuto: pivot (median of three) parked at hi-1; returns its final index.
+// Equal keys all land on one side, so many duplicates make it O(n²).
+template <class A>
+int PartitionLomuto(A& arr, int lo, int hi)
+{
+    MedianOfThree(arr, lo, hi, hi - 1);
+
+    int p = hi - 1;
+    int store = lo;
+    for (int i = lo; i < p; ++i)
+    {
+        if (arr.Less(i, p))
+        {
+            if (i != store)
+                arr.Swap(i, store);
+            store++;
+        }
+    }
+    if (store != p)
+        arr.Swap(store, p);
+    return store;
+}
+
+// Hoare: returns j with [lo, j] <= pivot <= [j+1, hi)
+template <class A>
+int PartitionHoare(A& arr, int lo, int hi)
+{
+    MedianOfThree(arr, lo, hi, lo);
+
+    int pivot = arr.Get(lo);
+    int i = lo - 1;
+    int j = hi;
+    for (;;)
+    {
+        do { ++i; } while (arr.LessValues(arr.Get(i), pivot, i, lo));
+        do { --j; } while (arr.LessValues(pivot, arr.Get(j), lo, j));
+        if (i >= j)
+            return j;
+        arr.Swap(i, j);
+    }
+}
+
+// Both quicksorts recurse into the smaller side and loop on the
+// larger, so stack depth stays O(log n) even on bad pivots
+template <class A>
+void QuickSortLomuto(A& arr, int lo, int hi)
+{
+    while (hi - lo > 1)
+    {
+        int p = PartitionLomuto(arr, lo, hi);
+        arr.Lock(p);
+
+        if (p - lo < hi - p - 1)
+        {
+            QuickSortLomuto(arr, lo, p);
+            lo = p + 1;
+        }
+        else
+        {
+            QuickSortLomuto(arr, p + 1, hi);
+            hi = p;
+        }
+    }
+    if (hi - lo == 1)
+        arr.Lock(lo);
+}
+
+template <class A>
+void QuickSortHoare(A& arr, int lo, int hi)
+{
+    while (hi - lo > 1)
+    {
+        int j = PartitionHoare(arr, lo, hi);
+
+        if (j + 1 - lo < hi - j - 1)
+        {
+            QuickSortHoare(arr, lo, j + 1);
+            lo = j + 1;
+        }
+        else
+        {
+            QuickSortHoare(arr, j + 1, hi);
+            hi = j + 1;
+        }
+    }
+}
+
+// Max-heap on [lo, hi), node k's children at lo + 2(k-lo) + 1 / + 2
+template <class A>
+void SiftDown(A& arr, int lo, int k, int hi)
+{
+    for (;;)
+    {
+        int child = lo + 2 * (k - lo) + 1;
+        if (child >= hi)
+            return;
+        if (child + 1 < hi && arr.Less(child, child + 1))
+            child++;
+        if (!arr.Less(k, child))
+            return;
+        arr.Swap(k, child);
+        k = child;
+    }
+}
+
+template <class A>
+void HeapSortRange(A& arr, int lo, int hi)
+{
+    for (int k = lo + (hi - lo) / 2 - 1; k >= lo; --k)
+        SiftDown(arr, lo, k, hi);
+
+    for (int end = hi - 1; end > lo; --end)
+    {
+        arr.Swap(lo, end);
+        arr.Lock(end);
+        SiftDown(arr, lo, lo, end);
+    }
+    if (hi > lo)
+        arr.Lock(lo);
+}
+
+// LSD radix sort, one byte per pass. Keys are flipped to unsigned
+// order (sign bit) and bytes where every key agrees are skipped.
+// There are no compares at all: each pass is n writes.
+template <class A>
+void RadixSort(A& arr)
+{
+    int n = arr.Size();
+    if (n < 2)
+        return;
+
+    std::vector<uint32_t> keys(n);
+    uint32_t differ = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        keys[i] = (uint32_t)arr.Get(i) ^ 0x80000000u;
+        differ |= keys[i] ^ keys[0];
+    }
+
+    std::vector<uint32_t> sorted(n);
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        if (((differ >> shift) & 0xFF) == 0)
+            continue;
+
+        int count[257] = {};
+        for (int i = 0; i < n; ++i)
+            count[((keys[i] >> shift) & 0xFF) + 1]++;
+        for (int d = 0; d < 256; ++d)
+            count[d + 1] += count[d];
+
+        for (int i = 0; i < n; ++i)
+            sorted[count[(keys[i] >> shift) & 0xFF]++] = keys[i];
+
+        keys.swap(sorted);
+        for (int i = 0; i < n; ++i)
+            arr.Write(i, (int)(keys[i] ^ 0x80000000u));
+    }
+}
+
+// Introsort: Hoare quicksort until the depth budget (2 log2 n) runs
+// out, heap sort below that, insertion sort for ranges of <= 16
+template <class A>
+void IntroSortRange(A& arr, int lo, int hi, int depth)
+{
+    while (hi - lo > 16)
+    {
+        if (depth-- == 0)
+        {
+            HeapSortRange(arr, lo, hi);
+            return;
+        }
+
+        int j = PartitionHoare(arr, lo, hi);
+        if (j + 1 - lo < hi - j - 1)
+        {
+            IntroSortRange(arr, lo, j + 1, depth);
+            lo = j + 1;
+        }
+        else
+        {
+            IntroSortRange(arr, j + 1, hi, depth);
+            hi = j + 1;
+        }
+    }
+    InsertionSort(arr, lo, hi);
+}
+
+template <class A>
+void IntroSort(A& arr)
+{
+    int depth = 0;
+    for (int n = arr.Size(); n > 1; n >>= 1)
+        depth += 2;
+    IntroSortRange(arr, 0, arr.Size(), depth);
+}
+
+// SIMD merge sort (SimdSort.h). A PlainArray runs the vector code
+// itself; any other array gets the same steps one element at a
+// time, so playback shows what the registers do:
+//   block network → Compare / Swap down each column of a block
+//   transpose     → Swaps across the block's diagonal
+//   merge passes  → runs of SIMD_LANES, then 2×, 4×, ... merged
+// A tail shorter than a block is insertion sorted in place of the
+// INT_MAX padding.
+template <class A>
+void SimdMergeSort(A& arr)
+{
+    const int W = SIMD_LANES;
+    int n    = arr.Size();
+    int full = n / SIMD_BLOCK * SIMD_BLOCK;
+
+    for (int base = 0; base < full; base += SIMD_BLOCK)
+    {
+        for (int k = 0; k < SIMD_NETWORK_SIZE; ++k)
+        {
+            for (int lane = 0; lane < W; ++lane)
+            {
+                int x = base + SIMD_NETWORK[k][0] * W + lane;
+                int y = base + SIMD_NETWORK[k][1] * W + lane;
+                if (arr.Less(y, x))
+                    arr.Swap(x, y);
+            }
+        }
+
+        for (int r = 0; r < W; ++r)
+            for (int c = r + 1; c < W; ++c)
+                arr.Swap(base + r * W + c, base + c * W + r);
+    }
+    InsertionSort(arr, full, n);
+
+    std::vector<int> buf(n);
+    for (int width = W; width < n; width *= 2)
+    {
+        for (int lo = 0; lo + width < n; lo += 2 * width)
+            MergeHalves(arr, buf, lo, lo + width, std::min(lo + 2 * width, n));
+    }
+}
+
+inline void SimdMergeSort(PlainArray& arr)
+{
+    SimdSort(arr.a, arr.n);
+}
+
+// ---------------------------------------------------------
+// Algorithm table
+// ---------------------------------------------------------
+enum class SortAlgorithm
+{
+    Bubble,
+    Insertion,
+    Selection,
+    Shell,
+    Merge,
+    QuickLomuto,
+    QuickHoare,
+    Heap,
+    Radix,
+    Intro,
+    Simd,
+    Count
+};
+
+const char* const SORT_NAMES[] =
+{
+    "Bubble",
+    "Insertion",
+    "Selection",
+    "Shell",
+    "Merge",
+    "Quick (Lomuto)",
+    "Quick (Hoare)",
+    "Heap",
+    "Radix (LSD)",
+    "Introsort",
+    "SIMD merge (" SIMD_KERNEL_NAME ")"
+};
+
+template <class A>
+void RunSort(SortAlgorithm algorithm, A& arr)
+{
+    int n = arr.Size();
+    switch (algorithm)
+    {
+        case SortAlgorithm::Bubble:      BubbleSort(arr);                break;
+        case SortAlgorithm::Insertion:   InsertionSort(arr, 0, n);       break;
+        case SortAlgorithm::Selection:   SelectionSort(arr);             break;
+        case SortAlgorithm::Shell:       ShellSort(arr);                 break;
+        case SortAlgorithm::Merge:       MergeSort(arr);                 break;
+        case SortAlgorithm::QuickLomuto: QuickSortLomuto(arr, 0, n);     break;
+        case SortAlgorithm::QuickHoare:  QuickSortHoare(arr, 0, n);      break;
+        case SortAlgorithm::Heap:        HeapSortRange(arr, 0, n);       break;
+        case SortAlgorithm::Radix:       RadixSort(arr);                 break;
+        case SortAlgorithm::Intro:       IntroSort(arr);                 break;
+        case SortAlgorithm::Simd:        SimdMergeSort(arr);             break;
+        default:                                                         break;
+    }
+}
+
+// ---------------------------------------------------------
+// Recorded runs
+// ---------------------------------------------------------
+// A SortLog is a whole sort, recorded up front, that can then be
+// played from any step in either direction.
+//
+// LoggedEvent packs an event into 8 bytes: the type sits in the top
+// two bits of `head`, the index a in the rest. A Write keeps
+// old ^ new in b instead of the new value, so every event can be
+// undone from the record alone (swap and write are their own
+// inverse, lock ↔ unlock).
+//
+// Snapshots of the values and lock flags are taken every
+// `interval` events (2n, at least 4096), so seeking replays at
+// most one interval instead of the whole log. The log ends with a
+// Lock for every index the algorithm never locked itself, which
+// leaves the array fully locked at the last step.
+// ---------------------------------------------------------
+struct LoggedEvent
+{
+    uint32_t head;
+    int32_t  b;
+};
+
+inline LoggedEvent PackEvent(SortEventType type, int a, int b)
+{
+    return { ((uint32_t)type << 30) | (uint32_t)a, b };
+}
+
+inline SortEventType EventType(const LoggedEvent& e) { return (SortEventType)(e.head >> 30); }
+inline int           EventIndex(const LoggedEvent& e) { return (int)(e.head & 0x3FFFFFFFu); }
+
+struct SortSnapshot
+{
+    std::vector<int>  values;
+    std::vector<bool> locked;
+};
+
+struct SortLog
+{
+    int    n        = 0;
+    size_t interval = 0;        // events between snapshots
+    bool   complete = false;    // false: stopped at the event limit or cancelled
+    size_t cut      = 0;        // !complete: events logged by the sort itself;
+                                // the rest write the final order directly
+
+    std::vector<LoggedEvent>  events;
+    std::vector<SortSnapshot> snapshots;   // [k] = state after k * interval events
+
+    long long compares = 0;
+    long long swaps    = 0;
+    long long writes   = 0;
+};
+
+// Runs `algorithm` over `values`, recording into `log`. Gives up
+// (log.complete = false) once maxEvents are recorded or `cancel`
+// turns true, so an O(n²) sort over millions can't run away.
+//
+// Hitting the limit still leaves a log that ends sorted: the sort
+// stops 2n events short, then one Write per index still off its
+// final value and the remaining Locks finish the run (log.cut marks
+// where). A cancelled log just stops.
+inline void RecordSort(SortAlgorithm algorithm, std::vector<int> values, SortLog& log,
+                       size_t maxEvents, const std::atomic<bool>* cancel = nullptr)
+{
+    struct Stop {};
+
+    int n = (int)values.size();
+    log = SortLog();
+    log.n        = n;
+    log.interval = std::max<size_t>(4096, 2 * (size_t)n);
+
+    size_t budget = maxEvents > 2 * (size_t)n ? maxEvents - 2 * (size_t)n : 0;
+
+    // The sort runs ahead of its chunked events, so the log keeps its
+    // own copy of the array (for the old values and the snapshots)
+    std::vector<int>  mirror = values;
+    std::vector<bool> locked(n, false);
+
+    auto Record = [&](SortEventType type, int a, int b)
+    {
+        if (log.events.size() % log.interval == 0)
+            log.snapshots.push_back({ mirror, locked });
+
+        switch (type)
+        {
+            case SortEventType::Compare:
+                log.compares++;
+                break;
+            case SortEventType::Swap:
+                log.swaps++;
+                std::swap(mirror[a], mirror[b]);
+                break;
+            case SortEventType::Write:
+                log.writes++;
+                b ^= mirror[a];
+                mirror[a] ^= b;
+                break;
+            case SortEventType::Lock:
+                locked[a] = true;
+                break;
+        }
+        log.events.push_back(PackEvent(type, a, b));
+    };
+
+    TracedArray arr(values, [&](std::vector<SortEvent>& chunk)
+    {
+        if (log.events.size() + chunk.size() > budget || (cancel && *cancel))
+            throw Stop();
+        for (const SortEvent& e : chunk)
+            Record(e.type, e.a, e.b);
+    });
+
+    bool cutShort = false;
+    try
+    {
+        RunSort(algorithm, arr);
+        arr.Flush();
+    }
+    catch (const Stop&)
+    {
+        if (cancel && *cancel)
+            return;
+        cutShort = true;
+    }
+
+    if (cutShort)
+    {
+        log.cut = log.events.size();
+
+        // Not the algorithm's work, so they stay out of its counts
+        long long writes = log.writes;
+        std::vector<int> sorted = mirror;
+        std::sort(sorted.begin(), sorted.end());
+        for (int i = 0; i < n; ++i)
+        {
+            if (mirror[i] != sorted[i])
+                Record(SortEventType::Write, i, sorted[i]);
+        }
+        log.writes = writes;
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        if (!locked[i])
+            Record(SortEventType::Lock, i, 0);
+    }
+    log.complete = !cutShort;
+}